@@ -1,5 +1,17 @@
 #include "AnalyzeBenchmarks.hpp"
 #include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#if defined(_WIN32)
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 using namespace central64;
 
@@ -33,11 +45,123 @@ std::vector<std::pair<Offset2D, Offset2D>> ReadScenarioFile(const std::filesyste
     return scenarios;
 }
 
+void PinCurrentThread(int threadIndex)
+{
+    // Select a core in round-robin fashion from the cores that the process is allowed to run on, so that a restriction
+    // such as taskset or a cgroup is respected. Pinning is skipped on platforms without a supported affinity API.
+    std::vector<int> allowedCores{};
+    bool pinned = false;
+#if defined(_WIN32)
+    DWORD_PTR processMask = 0;
+    DWORD_PTR systemMask = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) {
+        for (int core = 0; core < int(8*sizeof(DWORD_PTR)); ++core) {
+            if (processMask & (DWORD_PTR(1) << core)) {
+                allowedCores.push_back(core);
+            }
+        }
+    }
+    if (!allowedCores.empty()) {
+        const int coreIndex = allowedCores[threadIndex%allowedCores.size()];
+        pinned = (SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << coreIndex) != 0);
+    }
+#elif defined(__linux__)
+    cpu_set_t allowedSet;
+    CPU_ZERO(&allowedSet);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &allowedSet) == 0) {
+        for (int core = 0; core < CPU_SETSIZE; ++core) {
+            if (CPU_ISSET(core, &allowedSet)) {
+                allowedCores.push_back(core);
+            }
+        }
+    }
+    if (!allowedCores.empty()) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(allowedCores[threadIndex%allowedCores.size()], &cpuSet);
+        pinned = (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) == 0);
+    }
+#else
+    pinned = true;
+#endif
+
+    // Report the first failure only, since every thread is likely to fail for the same reason.
+    static std::atomic<bool> failureReported{ false };
+    if (!pinned && !failureReported.exchange(true)) {
+        printf("Failed to pin analysis thread %d to a core, so runtimes may vary more than usual\n", threadIndex);
+    }
+}
+
+double Microseconds(std::chrono::steady_clock::duration duration)
+{
+    // Convert without truncating to whole microseconds, since many queries take less than one microsecond.
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+double RuntimePercentile(const std::vector<double>& sortedSamples, double percent)
+{
+    // Use the nearest-rank method, so each reported percentile is an observed runtime.
+    if (sortedSamples.empty()) {
+        return 0.0;
+    }
+    int rank = int(std::ceil(0.01*percent*sortedSamples.size()));
+    return sortedSamples[std::clamp(rank - 1, 0, int(sortedSamples.size()) - 1)];
+}
+
+void PrintRuntimeHistogram(const std::vector<double>& sortedSamples)
+{
+    // Group the runtimes into bins that double in width, since runtimes typically span several orders of magnitude.
+    if (sortedSamples.empty()) {
+        return;
+    }
+    const int minExponent = int(std::floor(std::log2(std::max(sortedSamples.front(), 1e-3))));
+    const int maxExponent = int(std::floor(std::log2(std::max(sortedSamples.back(), 1e-3))));
+    std::vector<int> binCounts(maxExponent - minExponent + 1, 0);
+    for (double sample : sortedSamples) {
+        int exponent = int(std::floor(std::log2(std::max(sample, 1e-3))));
+        ++binCounts[std::clamp(exponent, minExponent, maxExponent) - minExponent];
+    }
+    const int maxBinCount = *std::max_element(binCounts.begin(), binCounts.end());
+    printf("Runtime Histogram (us):\n");
+    for (int i = 0; i < int(binCounts.size()); ++i) {
+        int barLength = (50*binCounts[i] + maxBinCount - 1)/maxBinCount;
+        printf("  [%12.3f, %12.3f) %8d %s\n",
+               std::ldexp(1.0, minExponent + i),
+               std::ldexp(1.0, minExponent + i + 1),
+               binCounts[i],
+               std::string(barLength, '#').c_str());
+    }
+}
+
+void SetMeanStageRuntimes(BenchmarkResult& result, const StageTimes& times, int pathCount)
+{
+    // Normalize the stage times in the same way as the overall runtime, by the number of paths produced.
+    if (pathCount > 0) {
+        result.meanSearchRuntime = 1e-3*times.search/pathCount;
+        result.meanCentralExtractionRuntime = 1e-3*times.centralExtraction/pathCount;
+        result.meanRegularExtractionRuntime = 1e-3*times.regularExtraction/pathCount;
+        result.meanSmoothingRuntime = 1e-3*times.smoothing/pathCount;
+    }
+}
+
+void SetMeanStatistics(BenchmarkResult& result, const SearchStatistics& statistics, int pathCount)
+{
+    // Normalize the statistics in the same way as the overall runtime, by the number of paths produced.
+    if (pathCount > 0) {
+        result.meanExpansions = double(statistics.expansions)/pathCount;
+        result.meanPushes = double(statistics.pushes)/pathCount;
+        result.meanStalePops = double(statistics.stalePops)/pathCount;
+        result.meanJumpCells = double(statistics.jumpCells)/pathCount;
+        result.meanLineOfSightChecks = double(statistics.lineOfSightChecks)/pathCount;
+    }
+}
+
 template <int L>
 void PrintResults(const std::string& label,
                   PathPlanner<L>& planner,
                   bool allNodes,
-                  BenchmarkResult result)
+                  const BenchmarkResult& result,
+                  bool histogram)
 {
     printf("%s\n", label.c_str());
     printf("%d-Neighbor Grid with %s-Aligned Cells\n",
@@ -49,6 +173,17 @@ void PrintResults(const std::string& label,
            allNodes ? planner.Search().AllNodesMethodName().c_str() :
                       planner.Search().MethodName().c_str(),
            planner.Smoothing().MethodName().c_str());
+    if (result.blockSize != 0) {
+        printf("Block Size = %d\n", result.blockSize);
+    }
+    if (result.calibratedJumpCost) {
+        if (result.jumpCost >= 0.0) {
+            printf("Jump Cost = %g\n", result.jumpCost);
+        }
+        else {
+            printf("Jump Cost = Calibrated for each map\n");
+        }
+    }
     std::string resultPrefix = (result.totalScenarios > 1) ? "Mean " : "";
     printf("%sPath Length = %.6f\n", resultPrefix.c_str(), result.meanPathLength);
     printf("%sRuntime (us) = %.6f\n", resultPrefix.c_str(), result.meanRuntime);
@@ -56,6 +191,36 @@ void PrintResults(const std::string& label,
         printf("Valid Paths = %d\n", result.validPaths);
         printf("Total Scenarios = %d\n", result.totalScenarios);
     }
+    if (result.runtimeSamples.size() > 1) {
+        std::vector<double> sortedSamples = result.runtimeSamples;
+        std::sort(sortedSamples.begin(), sortedSamples.end());
+        printf("Runtime Percentiles (us): p50 = %.3f, p90 = %.3f, p99 = %.3f, p99.9 = %.3f, max = %.3f\n",
+               RuntimePercentile(sortedSamples, 50.0),
+               RuntimePercentile(sortedSamples, 90.0),
+               RuntimePercentile(sortedSamples, 99.0),
+               RuntimePercentile(sortedSamples, 99.9),
+               sortedSamples.back());
+        if (histogram) {
+            PrintRuntimeHistogram(sortedSamples);
+        }
+    }
+    if (StageTimes::enabled) {
+        printf("%sStage Runtimes (us): search = %.3f, central extraction = %.3f, regular extraction = %.3f, smoothing = %.3f\n",
+               resultPrefix.c_str(),
+               result.meanSearchRuntime,
+               result.meanCentralExtractionRuntime,
+               result.meanRegularExtractionRuntime,
+               result.meanSmoothingRuntime);
+    }
+    if (SearchStatistics::enabled) {
+        printf("%sStatistics: expansions = %.1f, pushes = %.1f, stale pops = %.1f, jump cells = %.1f, line-of-sight checks = %.1f\n",
+               resultPrefix.c_str(),
+               result.meanExpansions,
+               result.meanPushes,
+               result.meanStalePops,
+               result.meanJumpCells,
+               result.meanLineOfSightChecks);
+    }
     printf("\n");
 }
 
@@ -66,7 +231,8 @@ BenchmarkResult AnalyzeBenchmark(const std::filesystem::path& mapFilePath,
                                  central64::SearchMethod searchMethod,
                                  central64::SmoothingMethod smoothingMethod,
                                  bool centralize,
-                                 int scenarioIndex)
+                                 const AnalysisOptions& options,
+                                 bool printResults)
 {
     std::filesystem::path scenFilePath = mapFilePath.string() + ".scen";
 
@@ -76,7 +242,16 @@ BenchmarkResult AnalyzeBenchmark(const std::filesystem::path& mapFilePath,
     BenchmarkResult result;
 
     if (!inputCells.empty() && !scenarios.empty()) {
-        auto planner = PathPlanner<L>{ inputCells, alignment, searchMethod, smoothingMethod, centralize };
+        auto planner = PathPlanner<L>{ inputCells, alignment, searchMethod, smoothingMethod, centralize, true, options.blockSize, options.searchThreadCount };
+        result.blockSize = planner.BlockSize();
+        result.calibratedJumpCost = (searchMethod == SearchMethod::AdaptiveBoundedJumpPoint);
+        result.jumpCost = result.calibratedJumpCost ? planner.JumpCost().Distance() : 0.0;
+        if (options.precomputeSuccessors) {
+            planner.PrecomputeSuccessors();
+        }
+        const int scenarioIndex = options.scenarioIndex;
+        planner.ResetTimes();
+        planner.ResetStatistics();
         if (scenarioIndex >= 0) {
             if (scenarioIndex >= int(scenarios.size())) {
                 printf("Warning: Scenario index %d must be less than number of scenarios (%d)\n", scenarioIndex, int(scenarios.size()));
@@ -95,9 +270,12 @@ BenchmarkResult AnalyzeBenchmark(const std::filesystem::path& mapFilePath,
                 }
                 auto tB = std::chrono::steady_clock::now();
                 result.meanPathLength = PathLength(pathVertices);
-                result.meanRuntime = double(std::chrono::duration_cast<std::chrono::microseconds>(tB - tA).count());
+                result.meanRuntime = Microseconds(tB - tA);
+                result.runtimeSamples = { result.meanRuntime };
                 result.validPaths = pathVertices.empty() ? 0 : 1;
                 result.totalScenarios = 1;
+                SetMeanStageRuntimes(result, planner.Times(), 1);
+                SetMeanStatistics(result, planner.Statistics(), 1);
                 std::string label = "Result for " + mapFilePath.filename().string() + ", scenario " + std::to_string(scenarioIndex);
                 PrintResults(label, planner, allNodes, result);
                 printf("%s\n", ToString(pathVertices).c_str());
@@ -115,13 +293,15 @@ BenchmarkResult AnalyzeBenchmark(const std::filesystem::path& mapFilePath,
                         auto tA = std::chrono::steady_clock::now();
                         planner.SearchAllNodes(scen.first);
                         auto tB = std::chrono::steady_clock::now();
-                        totalRuntime += std::chrono::duration_cast<std::chrono::microseconds>(tB - tA).count();
+                        result.runtimeSamples.push_back(Microseconds(tB - tA));
+                        totalRuntime += result.runtimeSamples.back();
                     }
                     else {
                         auto tA = std::chrono::steady_clock::now();
                         std::vector<Offset2D> pathVertices = planner.SamplePath(scen.first);
                         auto tB = std::chrono::steady_clock::now();
-                        totalRuntime += std::chrono::duration_cast<std::chrono::microseconds>(tB - tA).count();
+                        result.runtimeSamples.push_back(Microseconds(tB - tA));
+                        totalRuntime += result.runtimeSamples.back();
                         if (!pathVertices.empty()) {
                             totalPathLength += PathLength(pathVertices);
                             ++validPaths;
@@ -132,7 +312,8 @@ BenchmarkResult AnalyzeBenchmark(const std::filesystem::path& mapFilePath,
                         auto tA = std::chrono::steady_clock::now();
                         std::vector<Offset2D> pathVertices = planner.SamplePath(scen.second);
                         auto tB = std::chrono::steady_clock::now();
-                        totalRuntime += std::chrono::duration_cast<std::chrono::microseconds>(tB - tA).count();
+                        result.runtimeSamples.push_back(Microseconds(tB - tA));
+                        totalRuntime += result.runtimeSamples.back();
                         if (!pathVertices.empty()) {
                             totalPathLength += PathLength(pathVertices);
                             ++validPaths;
@@ -146,6 +327,8 @@ BenchmarkResult AnalyzeBenchmark(const std::filesystem::path& mapFilePath,
                 }
                 result.validPaths = validPaths;
                 result.totalScenarios = totalScenarios;
+                SetMeanStageRuntimes(result, planner.Times(), validPaths);
+                SetMeanStatistics(result, planner.Statistics(), validPaths);
             }
             else {
                 double totalPathLength = 0.0;
@@ -156,7 +339,8 @@ BenchmarkResult AnalyzeBenchmark(const std::filesystem::path& mapFilePath,
                     auto tA = std::chrono::steady_clock::now();
                     std::vector<Offset2D> pathVertices = planner.PlanPath(scen.first, scen.second);
                     auto tB = std::chrono::steady_clock::now();
-                    totalRuntime += std::chrono::duration_cast<std::chrono::microseconds>(tB - tA).count();
+                    result.runtimeSamples.push_back(Microseconds(tB - tA));
+                    totalRuntime += result.runtimeSamples.back();
                     if (!pathVertices.empty()) {
                         totalPathLength += PathLength(pathVertices);
                         ++validPaths;
@@ -169,9 +353,13 @@ BenchmarkResult AnalyzeBenchmark(const std::filesystem::path& mapFilePath,
                 }
                 result.validPaths = validPaths;
                 result.totalScenarios = totalScenarios;
+                SetMeanStageRuntimes(result, planner.Times(), validPaths);
+                SetMeanStatistics(result, planner.Statistics(), validPaths);
+            }
+            if (printResults) {
+                std::string label = "Results for " + mapFilePath.filename().string();
+                PrintResults(label, planner, allNodes, result, options.histogram);
             }
-            std::string label = "Results for " + mapFilePath.filename().string();
-            PrintResults(label, planner, allNodes, result);
         }
     }
 
@@ -185,36 +373,97 @@ void AnalyzeBenchmarkSet(const std::filesystem::path& filePath,
                          central64::SearchMethod searchMethod,
                          central64::SmoothingMethod smoothingMethod,
                          bool centralize,
-                         int scenarioIndex)
+                         const AnalysisOptions& options)
 {
     if (!std::filesystem::is_directory(filePath)) {
-        AnalyzeBenchmark<L>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, scenarioIndex);
+        AnalyzeBenchmark<L>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, options);
     }
     else {
-        if (scenarioIndex != -1) {
-            printf("Warning: Ignoring scenario index %d because multiple maps are being analyzed\n", scenarioIndex);
+        if (options.scenarioIndex != -1) {
+            printf("Warning: Ignoring scenario index %d because multiple maps are being analyzed\n", options.scenarioIndex);
             printf("\n");
         }
-        double totalPathLength = 0.0;
-        double totalRuntime = 0;
-        int validPaths = 0;
-        int totalScenarios = 0;
-        int benchmarkCount = 0;
+
+        // Collect the map files first, so that they are reported in the same order whether analyzed serially or in parallel.
+        std::vector<std::filesystem::path> mapFilePaths{};
         for (const auto& directoryEntry : std::filesystem::directory_iterator{ filePath }) {
             const std::filesystem::path& directoryEntryPath = directoryEntry.path();
             if (!std::filesystem::is_directory(directoryEntryPath)) {
                 if (directoryEntryPath.extension() == ".map") {
-                    BenchmarkResult result = AnalyzeBenchmark<L>(directoryEntryPath, allNodes, alignment, searchMethod, smoothingMethod, centralize);
-                    totalPathLength += result.meanPathLength;
-                    totalRuntime += result.meanRuntime;
-                    validPaths += result.validPaths;
-                    totalScenarios += result.totalScenarios;
-                    ++benchmarkCount;
+                    mapFilePaths.push_back(directoryEntryPath);
+                }
+            }
+        }
+
+        AnalysisOptions mapOptions = options;
+        mapOptions.scenarioIndex = -1;
+        std::vector<BenchmarkResult> results(mapFilePaths.size());
+        if (options.threadCount <= 1) {
+            for (size_t i = 0; i < mapFilePaths.size(); ++i) {
+                results[i] = AnalyzeBenchmark<L>(mapFilePaths[i], allNodes, alignment, searchMethod, smoothingMethod, centralize, mapOptions);
+            }
+        }
+        else {
+            // Distribute the maps across threads. Each thread is pinned to its own core and creates its own
+            // planner, so the queries of one map are timed on a single core without sharing any search data.
+            std::atomic<int> nextMapIndex{ 0 };
+            std::vector<std::thread> threads{};
+            for (int threadIndex = 0; threadIndex < options.threadCount; ++threadIndex) {
+                threads.emplace_back([&, threadIndex]() {
+                    PinCurrentThread(threadIndex);
+                    for (int i = nextMapIndex++; i < int(mapFilePaths.size()); i = nextMapIndex++) {
+                        results[i] = AnalyzeBenchmark<L>(mapFilePaths[i], allNodes, alignment, searchMethod, smoothingMethod, centralize, mapOptions, false);
+                    }
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+
+            // Print the results of each map only after all threads have finished, so the output is not interleaved.
+            auto planner = PathPlanner<L>{ {{0}}, alignment, searchMethod, smoothingMethod, centralize };
+            for (size_t i = 0; i < mapFilePaths.size(); ++i) {
+                if (results[i].totalScenarios > 0) {
+                    std::string label = "Results for " + mapFilePaths[i].filename().string();
+                    PrintResults(label, planner, allNodes, results[i], options.histogram);
                 }
             }
         }
 
+        double totalPathLength = 0.0;
+        double totalRuntime = 0;
+        int validPaths = 0;
+        int totalScenarios = 0;
+        int benchmarkCount = 0;
         BenchmarkResult overallResult;
+        overallResult.blockSize = results.empty() ? 0 : results.front().blockSize;
+        overallResult.calibratedJumpCost = (searchMethod == SearchMethod::AdaptiveBoundedJumpPoint);
+        overallResult.jumpCost = results.empty() ? 0.0 : results.front().jumpCost;
+        for (BenchmarkResult& result : results) {
+            if (result.blockSize != overallResult.blockSize) {
+                overallResult.blockSize = 0;
+            }
+            if (result.jumpCost != overallResult.jumpCost) {
+                overallResult.jumpCost = -1.0;
+            }
+            totalPathLength += result.meanPathLength;
+            totalRuntime += result.meanRuntime;
+            overallResult.meanSearchRuntime += result.meanSearchRuntime/mapFilePaths.size();
+            overallResult.meanCentralExtractionRuntime += result.meanCentralExtractionRuntime/mapFilePaths.size();
+            overallResult.meanRegularExtractionRuntime += result.meanRegularExtractionRuntime/mapFilePaths.size();
+            overallResult.meanSmoothingRuntime += result.meanSmoothingRuntime/mapFilePaths.size();
+            overallResult.meanExpansions += result.meanExpansions/mapFilePaths.size();
+            overallResult.meanPushes += result.meanPushes/mapFilePaths.size();
+            overallResult.meanStalePops += result.meanStalePops/mapFilePaths.size();
+            overallResult.meanJumpCells += result.meanJumpCells/mapFilePaths.size();
+            overallResult.meanLineOfSightChecks += result.meanLineOfSightChecks/mapFilePaths.size();
+            validPaths += result.validPaths;
+            totalScenarios += result.totalScenarios;
+            ++benchmarkCount;
+            // The percentiles of the set are computed over the pooled runtimes of all of its queries.
+            overallResult.runtimeSamples.insert(overallResult.runtimeSamples.end(), result.runtimeSamples.begin(), result.runtimeSamples.end());
+        }
+
         if (benchmarkCount > 0) {
             overallResult.meanPathLength = totalPathLength/benchmarkCount;
             overallResult.meanRuntime = totalRuntime/benchmarkCount;
@@ -224,7 +473,7 @@ void AnalyzeBenchmarkSet(const std::filesystem::path& filePath,
 
         auto planner = PathPlanner<L>{ {{0}}, alignment, searchMethod, smoothingMethod, centralize };
         std::string label = "Overall results for " + filePath.string();
-        PrintResults(label, planner, allNodes, overallResult);
+        PrintResults(label, planner, allNodes, overallResult, options.histogram);
     }
 }
 
@@ -234,13 +483,13 @@ void AnalyzeAllNeighborhoods(const std::filesystem::path& filePath,
                              central64::SearchMethod searchMethod,
                              central64::SmoothingMethod smoothingMethod,
                              bool centralize,
-                             int scenarioIndex)
+                             const AnalysisOptions& options)
 {
-    AnalyzeBenchmarkSet< 4>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, scenarioIndex);
-    AnalyzeBenchmarkSet< 8>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, scenarioIndex);
-    AnalyzeBenchmarkSet<16>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, scenarioIndex);
-    AnalyzeBenchmarkSet<32>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, scenarioIndex);
-    AnalyzeBenchmarkSet<64>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, scenarioIndex);
+    AnalyzeBenchmarkSet< 4>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, options);
+    AnalyzeBenchmarkSet< 8>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, options);
+    AnalyzeBenchmarkSet<16>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, options);
+    AnalyzeBenchmarkSet<32>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, options);
+    AnalyzeBenchmarkSet<64>(filePath, allNodes, alignment, searchMethod, smoothingMethod, centralize, options);
 }
 
 void AnalyzeAllSearchMethods(const std::filesystem::path& filePath,
@@ -248,43 +497,51 @@ void AnalyzeAllSearchMethods(const std::filesystem::path& filePath,
                              central64::CellAlignment alignment,
                              central64::SmoothingMethod smoothingMethod,
                              bool centralize,
-                             int scenarioIndex)
+                             const AnalysisOptions& options)
 {
-    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::AStar,            smoothingMethod, centralize, scenarioIndex);
-    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::JumpPoint,        smoothingMethod, centralize, scenarioIndex);
-    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::BoundedJumpPoint, smoothingMethod, centralize, scenarioIndex);
-    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::MixedAStar,       smoothingMethod, centralize, scenarioIndex);
-    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::MixedJumpPoint,   smoothingMethod, centralize, scenarioIndex);
+    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::AStar,                    smoothingMethod, centralize, options);
+    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::JumpPoint,                smoothingMethod, centralize, options);
+    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::BoundedJumpPoint,         smoothingMethod, centralize, options);
+    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::AdaptiveBoundedJumpPoint, smoothingMethod, centralize, options);
+    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::MixedAStar,               smoothingMethod, centralize, options);
+    AnalyzeAllNeighborhoods(filePath, allNodes, alignment, SearchMethod::MixedJumpPoint,           smoothingMethod, centralize, options);
 }
 
 void PerformPartialAnalysis(const std::filesystem::path& filePath,
                             bool allNodes,
-                            int scenarioIndex)
+                            const AnalysisOptions& options)
 {
-    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::No,       false, scenarioIndex);
-    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Greedy,   false, scenarioIndex);
-    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Greedy,   true,  scenarioIndex);
-    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Tentpole, false, scenarioIndex);
-    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Tentpole, true,  scenarioIndex);
-    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::MixedAStar,       SmoothingMethod::Tentpole, true,  scenarioIndex);
-    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::JumpPoint,        SmoothingMethod::Tentpole, true,  scenarioIndex);
-    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::BoundedJumpPoint, SmoothingMethod::Tentpole, true,  scenarioIndex);
-    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::MixedJumpPoint,   SmoothingMethod::Tentpole, true,  scenarioIndex);
-    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Tentpole, false, scenarioIndex);
-    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Tentpole, true,  scenarioIndex);
-    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::MixedAStar,       SmoothingMethod::Tentpole, true,  scenarioIndex);
-    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::JumpPoint,        SmoothingMethod::Tentpole, true,  scenarioIndex);
-    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::BoundedJumpPoint, SmoothingMethod::Tentpole, true,  scenarioIndex);
-    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::MixedJumpPoint,   SmoothingMethod::Tentpole, true,  scenarioIndex);
-    AnalyzeBenchmarkSet<64>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Tentpole, true,  scenarioIndex);
+    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::No,       false, options);
+    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Greedy,   false, options);
+    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Greedy,   true,  options);
+    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Tentpole, false, options);
+    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Tentpole, true,  options);
+    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::MixedAStar,       SmoothingMethod::Tentpole, true,  options);
+    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::JumpPoint,        SmoothingMethod::Tentpole, true,  options);
+    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::BoundedJumpPoint, SmoothingMethod::Tentpole, true,  options);
+    AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::MixedJumpPoint,   SmoothingMethod::Tentpole, true,  options);
+    if (!allNodes) {
+        AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::SubgoalGraph, SmoothingMethod::Tentpole, true, options);
+        AnalyzeBenchmarkSet< 8>(filePath, allNodes, CellAlignment::Corner, SearchMethod::ContractionHierarchy, SmoothingMethod::Tentpole, true, options);
+    }
+    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Tentpole, false, options);
+    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Tentpole, true,  options);
+    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::MixedAStar,       SmoothingMethod::Tentpole, true,  options);
+    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::JumpPoint,        SmoothingMethod::Tentpole, true,  options);
+    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::BoundedJumpPoint, SmoothingMethod::Tentpole, true,  options);
+    AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::MixedJumpPoint,   SmoothingMethod::Tentpole, true,  options);
+    if (!allNodes) {
+        AnalyzeBenchmarkSet<16>(filePath, allNodes, CellAlignment::Corner, SearchMethod::SubgoalGraph, SmoothingMethod::Tentpole, true, options);
+    }
+    AnalyzeBenchmarkSet<64>(filePath, allNodes, CellAlignment::Corner, SearchMethod::AStar,            SmoothingMethod::Tentpole, true,  options);
 }
 
 void PerformCompleteAnalysis(const std::filesystem::path& filePath,
                              bool allNodes,
-                             int scenarioIndex)
+                             const AnalysisOptions& options)
 {
-    AnalyzeAllSearchMethods(filePath, allNodes, CellAlignment::Corner, SmoothingMethod::Greedy,   false, scenarioIndex);
-    AnalyzeAllSearchMethods(filePath, allNodes, CellAlignment::Corner, SmoothingMethod::Tentpole, false, scenarioIndex);
-    AnalyzeAllSearchMethods(filePath, allNodes, CellAlignment::Corner, SmoothingMethod::Greedy,   true,  scenarioIndex);
-    AnalyzeAllSearchMethods(filePath, allNodes, CellAlignment::Corner, SmoothingMethod::Tentpole, true,  scenarioIndex);
+    AnalyzeAllSearchMethods(filePath, allNodes, CellAlignment::Corner, SmoothingMethod::Greedy,   false, options);
+    AnalyzeAllSearchMethods(filePath, allNodes, CellAlignment::Corner, SmoothingMethod::Tentpole, false, options);
+    AnalyzeAllSearchMethods(filePath, allNodes, CellAlignment::Corner, SmoothingMethod::Greedy,   true,  options);
+    AnalyzeAllSearchMethods(filePath, allNodes, CellAlignment::Corner, SmoothingMethod::Tentpole, true,  options);
 }
@@ -10,19 +10,53 @@ std::vector<std::vector<bool>> ReadMapFile(const std::filesystem::path& mapFileP
 
 std::vector<std::pair<central64::Offset2D, central64::Offset2D>> ReadScenarioFile(const std::filesystem::path& scenFilePath);
 
+void PinCurrentThread(int threadIndex);
+
+struct AnalysisOptions
+{
+    int scenarioIndex{ -1 };             // The 0-based index of the scenario to be solved, or -1 to solve all scenarios.
+    int threadCount{ 1 };                // The number of threads across which the maps of a benchmark set are distributed.
+    bool histogram{ false };             // Whether to print a histogram of the query runtimes along with the percentiles.
+    int blockSize{ 8 };                  // The block size of the mixed search methods, or 0 to select the block size for each map by calibration.
+    int searchThreadCount{ 1 };          // The number of threads across which the blocks of each mixed all-nodes search are processed.
+    bool precomputeSuccessors{ false };  // Whether to precompute the canonical and forced successors of every vertex when each map is loaded.
+};
+
 struct BenchmarkResult
 {
     double meanPathLength{ std::numeric_limits<double>::infinity() };
     double meanRuntime{ 0.0 };
     int validPaths{ 0 };
     int totalScenarios{ 0 };
+    std::vector<double> runtimeSamples{};  // The runtime of each timed query in microseconds, at nanosecond resolution.
+    int blockSize{ 0 };                    // The block size used by a mixed search method, or 0 if it does not apply or differs between maps.
+    bool calibratedJumpCost{ false };      // Whether the jump cost of a bounded jump point search was selected by calibration.
+    double jumpCost{ 0.0 };                // The jump cost selected by calibration, or a negative value if it differs between maps.
+    double meanSearchRuntime{ 0.0 };             // The mean time spent in the search stage, if stage timing is enabled.
+    double meanCentralExtractionRuntime{ 0.0 };  // The mean time spent extracting central grid paths, if stage timing is enabled.
+    double meanRegularExtractionRuntime{ 0.0 };  // The mean time spent extracting regular grid paths, if stage timing is enabled.
+    double meanSmoothingRuntime{ 0.0 };          // The mean time spent in the smoothing stage, if stage timing is enabled.
+    double meanExpansions{ 0.0 };         // The mean number of node expansions, if statistics counting is enabled.
+    double meanPushes{ 0.0 };             // The mean number of priority queue pushes, if statistics counting is enabled.
+    double meanStalePops{ 0.0 };          // The mean number of stale priority queue entries discarded, if statistics counting is enabled.
+    double meanJumpCells{ 0.0 };          // The mean number of cells scanned by jump traversals, if statistics counting is enabled.
+    double meanLineOfSightChecks{ 0.0 };  // The mean number of line-of-sight checks, if statistics counting is enabled.
 };
 
+void SetMeanStageRuntimes(BenchmarkResult& result, const central64::StageTimes& times, int pathCount);
+
+void SetMeanStatistics(BenchmarkResult& result, const central64::SearchStatistics& statistics, int pathCount);
+
+double RuntimePercentile(const std::vector<double>& sortedSamples, double percent);
+
+void PrintRuntimeHistogram(const std::vector<double>& sortedSamples);
+
 template <int L>
 void PrintResults(const std::string& label,
                   central64::PathPlanner<L>& planner,
                   bool allPaths,
-                  BenchmarkResult result);
+                  const BenchmarkResult& result,
+                  bool histogram = false);
 
 template <int L>
 BenchmarkResult AnalyzeBenchmark(const std::filesystem::path& mapFilePath,
@@ -31,7 +65,8 @@ BenchmarkResult AnalyzeBenchmark(const std::filesystem::path& mapFilePath,
                                  central64::SearchMethod searchMethod,
                                  central64::SmoothingMethod smoothingMethod,
                                  bool centralize,
-                                 int scenarioIndex = -1);
+                                 const AnalysisOptions& options = {},
+                                 bool printResults = true);
 
 template <int L>
 void AnalyzeBenchmarkSet(const std::filesystem::path& filePath,
@@ -40,7 +75,7 @@ void AnalyzeBenchmarkSet(const std::filesystem::path& filePath,
                          central64::SearchMethod searchMethod,
                          central64::SmoothingMethod smoothingMethod,
                          bool centralize,
-                         int scenarioIndex = -1);
+                         const AnalysisOptions& options = {});
 
 void AnalyzeAllNeighborhoods(const std::filesystem::path& filePath,
                              bool allNodes,
@@ -48,21 +83,21 @@ void AnalyzeAllNeighborhoods(const std::filesystem::path& filePath,
                              central64::SearchMethod searchMethod,
                              central64::SmoothingMethod smoothingMethod,
                              bool centralize,
-                             int scenarioIndex = -1);
+                             const AnalysisOptions& options = {});
 
 void AnalyzeAllSearchMethods(const std::filesystem::path& filePath,
                              bool allNodes,
                              central64::CellAlignment alignment,
                              central64::SmoothingMethod smoothingMethod,
                              bool centralize,
-                             int scenarioIndex);
+                             const AnalysisOptions& options = {});
 
 void PerformPartialAnalysis(const std::filesystem::path& filePath,
                             bool allNodes,
-                            int scenarioIndex = -1);
+                            const AnalysisOptions& options = {});
 
 void PerformCompleteAnalysis(const std::filesystem::path& filePath,
                              bool allNodes,
-                             int scenarioIndex = -1);
+                             const AnalysisOptions& options = {});
 
 #endif
@@ -1,9 +1,11 @@
 #include "AnalyzeBenchmarks.hpp"
 #include <cstdlib>
+#include <thread>
 
 void usage()
 {
-    printf("Usage: Central64Analysis <mode> <scope> <filepath> [<scenario>]\n");
+    printf("Usage: Central64Analysis [--threads <count>] [--histogram] [--block-size <size>] [--search-threads <count>]\n");
+    printf("                         [--precompute-successors] <mode> <scope> <filepath> [<scenario>]\n");
     printf("\n");
     printf("The <mode> must be one of the following:\n");
     printf("   heuristic  Plan one path for each benchmark scenario.\n");
@@ -20,10 +22,86 @@ void usage()
     printf("\n");
     printf("The <scenario> is the 0-based index of the scenario to be solved.\n");
     printf("    If not provided, all scenarios are solved.\n");
+    printf("\n");
+    printf("The --threads option distributes the maps of a benchmark set across\n");
+    printf("    <count> threads, each pinned to its own core. The runtime of each\n");
+    printf("    query is still measured on a single thread. The default is 1.\n");
+    printf("\n");
+    printf("The --histogram option prints a histogram of the query runtimes\n");
+    printf("    along with the runtime percentiles.\n");
+    printf("\n");
+    printf("The --block-size option sets the block size of the mixed search\n");
+    printf("    methods to <size>, which must be 1, 2, 4, 8, 16, 32, or 64.\n");
+    printf("    If <size> is auto, the block size is selected for each map by\n");
+    printf("    timing a short calibration run. The default is 8.\n");
+    printf("\n");
+    printf("The --search-threads option processes the blocks of each all-nodes\n");
+    printf("    search of the mixed A* search method across <count> threads.\n");
+    printf("    The paths are unchanged. The default is 1.\n");
+    printf("\n");
+    printf("The --precompute-successors option precomputes the canonical and\n");
+    printf("    forced successors of every vertex when each map is loaded, so\n");
+    printf("    that jump traversals look them up. The paths are unchanged.\n");
 }
 
 int main(int argc, char* argv[])
 {
+    AnalysisOptions options{};
+    while (argc > 1 && std::string(argv[1]).rfind("--", 0) == 0) {
+        std::string option = argv[1];
+        if (option == "--threads" && argc > 2) {
+            options.threadCount = std::strtol(argv[2], nullptr, 0);
+            if (options.threadCount < 1) {
+                usage();
+                return 4;
+            }
+            if (options.threadCount > int(std::thread::hardware_concurrency())) {
+                printf("Warning: Thread count %d exceeds the number of hardware threads (%d)\n", options.threadCount, int(std::thread::hardware_concurrency()));
+                printf("\n");
+            }
+            argc -= 2;
+            argv += 2;
+        }
+        else if (option == "--block-size" && argc > 2) {
+            // Accept "auto" or an entire number that is a supported block size, as the mixed search methods would throw otherwise.
+            const std::string size = argv[2];
+            char* sizeEnd = nullptr;
+            const long blockSize = std::strtol(argv[2], &sizeEnd, 0);
+            const bool validNumber = (sizeEnd != argv[2]) && (*sizeEnd == '\0') && (blockSize >= 1 && blockSize <= 64) &&
+                                     central64::PathPlanner<8>::IsValidBlockSize(int(blockSize));
+            options.blockSize = (size == "auto") ? central64::PathPlanner<8>::autoBlockSize : int(blockSize);
+            if (size != "auto" && !validNumber) {
+                usage();
+                return 4;
+            }
+            argc -= 2;
+            argv += 2;
+        }
+        else if (option == "--search-threads" && argc > 2) {
+            options.searchThreadCount = std::strtol(argv[2], nullptr, 0);
+            if (options.searchThreadCount < 1) {
+                usage();
+                return 4;
+            }
+            argc -= 2;
+            argv += 2;
+        }
+        else if (option == "--precompute-successors") {
+            options.precomputeSuccessors = true;
+            argc -= 1;
+            argv += 1;
+        }
+        else if (option == "--histogram") {
+            options.histogram = true;
+            argc -= 1;
+            argv += 1;
+        }
+        else {
+            usage();
+            return 4;
+        }
+    }
+
     if (argc < 4) {
         usage();
         return 1;
@@ -42,13 +120,13 @@ int main(int argc, char* argv[])
     }
 
     std::filesystem::path filePath = argv[3];
-    int scenarioIndex = (argc > 4) ? std::strtol(argv[4], nullptr, 0) : -1;
+    options.scenarioIndex = (argc > 4) ? std::strtol(argv[4], nullptr, 0) : -1;
 
     if (scope == "partial") {
-        PerformPartialAnalysis(filePath, (mode == "dijkstra"), scenarioIndex);
+        PerformPartialAnalysis(filePath, (mode == "dijkstra"), options);
     }
     else {
-        PerformCompleteAnalysis(filePath, (mode == "dijkstra"), scenarioIndex);
+        PerformCompleteAnalysis(filePath, (mode == "dijkstra"), options);
     }
 
     return 0;
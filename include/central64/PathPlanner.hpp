@@ -6,20 +6,32 @@
 #include <central64/search/JumpPointSearch.hpp>
 #include <central64/search/MixedAStarSearch.hpp>
 #include <central64/search/MixedJumpPointSearch.hpp>
+#include <central64/search/IncrementalSearch.hpp>
+#include <central64/search/SubgoalGraphSearch.hpp>
+#include <central64/search/ContractionHierarchySearch.hpp>
+#include <central64/search/CompressedPathDatabaseSearch.hpp>
 #include <central64/smoothing/NoSmoothing.hpp>
 #include <central64/smoothing/GreedySmoothing.hpp>
 #include <central64/smoothing/TentpoleSmoothing.hpp>
+#include <chrono>
+#include <random>
+#include <stdexcept>
 
 namespace central64 {
 
 /// An enumeration of grid path search methods.
 enum class SearchMethod
 {
-    AStar,             ///< A* Search
-    JumpPoint,         ///< Jump Point Search
-    BoundedJumpPoint,  ///< Bounded Jump Point Search
-    MixedAStar,        ///< Mixed A* Search
-    MixedJumpPoint     ///< Mixed Jump Point Search
+    AStar,                     ///< A* Search
+    JumpPoint,                 ///< Jump Point Search
+    BoundedJumpPoint,          ///< Bounded Jump Point Search
+    MixedAStar,                ///< Mixed A* Search
+    MixedJumpPoint,            ///< Mixed Jump Point Search
+    Incremental,               ///< Incremental Search (D* Lite), which reuses the previous search from the same source after grid updates
+    AdaptiveBoundedJumpPoint,  ///< Bounded Jump Point Search with a jump cost selected for each map by calibration
+    SubgoalGraph,              ///< Subgoal Graph Search, which preprocesses a static map into a graph of subgoals (8- and 16-neighbor grids only)
+    ContractionHierarchy,      ///< Contraction Hierarchy Search, which preprocesses a static map into a contraction hierarchy
+    CompressedPathDatabase     ///< Compressed Path Database Search, which precomputes the first moves of shortest paths between all pairs of vertices of a static map
 };
 
 /// An enumeration of grid path smoothing methods.
@@ -40,14 +52,50 @@ public:
     /// and followed by an application of the specified smoothing method (`smoothingMethod).
     /// If `centralize` is true, then the object produces central grid paths; otherwise it produces regular grid paths.
     /// If `fromSource` is true, then the object produces paths arranged from source to sample; otherwise from sample to source.
+    /// The mixed search methods partition the grid into `blockSize`-by-`blockSize` blocks, where the block size must be
+    /// 1, 2, 4, 8, 16, 32, or 64. If `blockSize` is `autoBlockSize`, then each block size is timed on a short calibration
+    /// run of sampled queries, and the fastest is selected for the map. Any other block size causes the constructor of
+    /// a mixed search method to throw `std::invalid_argument`.
+    /// The all-nodes searches of the mixed A* search method process blocks across `threadCount` threads.
+    /// The adaptive bounded jump point search method times each of the `calibrationJumpCosts` on a short calibration
+    /// run of sampled queries, and selects the fastest for the map.
+    /// The subgoal graph search method builds its graph when the planner is created, and requires `L` to be 8 or 16.
+    /// For other values of `L`, it causes the constructor to throw `std::invalid_argument`.
+    /// The contraction hierarchy search method builds its hierarchy when the planner is created.
+    /// The compressed path database search method builds its database when the planner is created, using an all-nodes
+    /// search from every vertex distributed across `threadCount` threads. If `centralize` is true, the database records
+    /// the first moves of central grid paths.
     PathPlanner(const std::vector<std::vector<bool>>& inputCells,
                 CellAlignment alignment = CellAlignment::Center,
                 SearchMethod searchMethod = SearchMethod::AStar,
                 SmoothingMethod smoothingMethod = SmoothingMethod::Tentpole,
                 bool centralize = true,
+                bool fromSource = true,
+                int blockSize = 8,
+                int threadCount = 1);
+
+    /// Create a path planning object that uses the contraction hierarchy search method, reading the hierarchy from
+    /// the binary `hierarchyStream` rather than building it. The stream should contain a hierarchy written by
+    /// `WriteHierarchy` for the same `inputCells`, `alignment`, and neighborhood size. If it does not, the hierarchy
+    /// is built as usual. The remaining arguments are as described above.
+    PathPlanner(const std::vector<std::vector<bool>>& inputCells,
+                CellAlignment alignment,
+                std::istream& hierarchyStream,
+                SmoothingMethod smoothingMethod = SmoothingMethod::Tentpole,
+                bool centralize = true,
                 bool fromSource = true);
 
+    static constexpr int autoBlockSize = 0;  ///< A block size value requesting that the block size of a mixed search method be selected by calibration.
+
+    /// Check whether `blockSize` is accepted by the mixed search methods, either as a block size or as `autoBlockSize`.
+    static constexpr bool IsValidBlockSize(int blockSize) { return blockSize == autoBlockSize || (blockSize >= 1 && blockSize <= 64 && (blockSize & (blockSize - 1)) == 0); }
+
+    static constexpr PathCost boundedJumpCost = PathCost(8);                                      ///< The jump cost of the bounded jump point search method.
+    static constexpr std::array<double, 8> calibrationJumpCosts = { 0, 1, 2, 4, 8, 16, 32, 64 };  ///< The jump costs compared by the adaptive bounded jump point search method.
+
     int NeighborhoodSize() const { return L; }  ///< Get the neighborhood size.
+    int BlockSize() const { return blockSize_; }  ///< Get the block size used by a mixed search method, including a size selected by calibration, or zero for other search methods.
+    PathCost JumpCost() const { return jumpCost_; }  ///< Get the jump cost used by the jump point search method or a bounded variant, including a cost selected by calibration, or zero for other search methods.
 
     const Grid2D<L>& Grid() const { return searchPtr_->Grid(); }  ///< Obtain a const reference to the grid.
     AbstractSearch<L>& Search() { return *searchPtr_; }           ///< Obtain a reference to the path search object.
@@ -56,26 +104,99 @@ public:
     bool Centralize() const { return centralize_; }  ///< Check whether the object produces central grid paths.
     bool FromSource() const { return fromSource_; }  ///< Check whether the object produces paths arranged from source to sample.
 
+    StageTimes Times() const;  ///< Get the cumulative time spent in each path planning stage, including smoothing, if stage timing is enabled.
+    void ResetTimes();         ///< Reset the cumulative stage times to zero.
+
+    SearchStatistics Statistics() const;  ///< Get the cumulative search and smoothing statistics, if statistics counting is enabled.
+    void ResetStatistics();               ///< Reset the cumulative search and smoothing statistics to zero.
+
     /// Compute a path between source coordinates `sourceCoords` and sample coordinates `sampleCoords`.
     /// If no path is found, return an empty vector.
     std::vector<Offset2D> PlanPath(Offset2D sourceCoords, Offset2D sampleCoords);
 
+    /// Compute a path from any of the source coordinates `sourceCoords` to the nearest of the sample coordinates `sampleCoords`,
+    /// using a single search. If the planner centralizes paths, the chosen pair is then searched again to obtain a central
+    /// grid path, so the query costs a second point-to-point search. If no path is found, return an empty vector.
+    std::vector<Offset2D> PlanPath(const std::vector<Offset2D>& sourceCoords, const std::vector<Offset2D>& sampleCoords);
+
     /// Conduct an all-nodes search from source coordinates `sourceCoords` to all reachable nodes in the grid.
     /// Paths originating or terminating at the source can then be efficiently sampled using `SamplePath`.
     void SearchAllNodes(Offset2D sourceCoords);
 
+    /// Conduct an all-nodes search from source coordinates `sourceCoords` that only reaches nodes within the cost cap `maxCost`.
+    /// Paths originating or terminating at the source can then be sampled using `SamplePath` for any vertex within the cap.
+    void SearchWithinCost(Offset2D sourceCoords, PathCost maxCost);
+
     /// Sample a path between sample coordinates `sampleCoords` and the previously supplied source.
     /// If no path is found, return an empty vector.
     std::vector<Offset2D> SamplePath(Offset2D sampleCoords);
 
+    /// Replace the rectangular region of input cells whose lowest coordinates are `cellCoords` with `regionCells`,
+    /// using the same convention as the `inputCells` supplied to the constructor, in the grids used for both search
+    /// and smoothing. Return the coordinates of every vertex whose set of connections has changed.
+    /// After an update, call `SearchAllNodes` again before sampling further paths. With the incremental search
+    /// method, the next search from the same source repairs the previous results rather than starting over.
+    /// With the compressed path database and contraction hierarchy search methods, any update requires the database or
+    /// hierarchy to be rebuilt, which takes as long as creating the planner. The rebuild is deferred to the next
+    /// `PlanPath` call, so that a batch of updates, including calls to `SetObstacle` and `ClearObstacle`, is paid for once.
+    /// With the subgoal graph search method, the next `PlanPath` call repairs only the part of the graph near the update.
+    std::vector<Offset2D> UpdateCells(Offset2D cellCoords, const std::vector<std::vector<bool>>& regionCells);
+
+    /// Precompute the canonical and forced successors of every vertex in the grid used for search, so that the jump point
+    /// search methods look them up rather than computing them at each step of a jump. This is intended for static maps.
+    void PrecomputeSuccessors() { searchPtr_->PrecomputeSuccessors(); }
+
+    /// Write the hierarchy of the contraction hierarchy search method to the binary `stream`, so that a planner can
+    /// later be created for the same map without building it again. Integers and costs are written in the byte order
+    /// of the current platform. The planner must use the contraction hierarchy search method. If cells have been updated
+    /// since the hierarchy was built, it is rebuilt first.
+    void WriteHierarchy(std::ostream& stream);
+
+    std::vector<Offset2D> SetObstacle(Offset2D cellCoords) { return UpdateCells(cellCoords, {{ true }}); }     ///< Obstruct the input cell at coordinates `cellCoords`, and return the coordinates of every vertex whose set of connections has changed.
+    std::vector<Offset2D> ClearObstacle(Offset2D cellCoords) { return UpdateCells(cellCoords, {{ false }}); }  ///< Clear the input cell at coordinates `cellCoords`, and return the coordinates of every vertex whose set of connections has changed.
+
 private:
     PathPlanner(const PathPlanner&) = delete;
     PathPlanner& operator=(const PathPlanner&) = delete;
 
+    // Create a mixed search object of type `MixedSearchType` with the block size `blockSize`, passing any additional
+    // constructor arguments `args`, or throw `std::invalid_argument` if the block size is not supported.
+    template <template <int, int> class MixedSearchType, typename... Args>
+    static std::unique_ptr<AbstractSearch<L>> CreateMixedSearch(const Grid2D<L>& grid, int blockSize, Args... args);
+
+    // Create a subgoal graph search object, or throw `std::invalid_argument` if the neighborhood size is not supported.
+    static std::unique_ptr<AbstractSearch<L>> CreateSubgoalGraphSearch(const Grid2D<L>& grid);
+
+    // Create a contraction hierarchy search object using the `hierarchy`, and record its address.
+    std::unique_ptr<AbstractSearch<L>> CreateContractionHierarchySearch(const Grid2D<L>& grid, ContractionHierarchy<L> hierarchy);
+
+    // Create a smoothing object of the type indicated by `smoothingMethod`.
+    static std::unique_ptr<AbstractSmoothing<L>> CreateSmoothing(const Grid2D<L>& grid, SmoothingMethod smoothingMethod);
+
+    // Time a calibration run of sampled queries for each allowed block size, and return the fastest block size.
+    template <template <int, int> class MixedSearchType>
+    int CalibrateBlockSize(const Grid2D<L>& grid) const;
+
+    // Time a calibration run of sampled queries for each calibration jump cost, and return the fastest jump cost.
+    PathCost CalibrateJumpCost(const Grid2D<L>& grid) const;
+
+    // Sample the pairs of vertices used as calibration queries, returning an empty vector if the map has too few connected vertices.
+    std::vector<Offset2D> SampleCalibrationVertices(const Grid2D<L>& grid) const;
+
+    // Run the calibration queries between the pairs of `sampledVertices` using the search object `search`
+    // once to warm the caches, and then return the duration of a second run.
+    std::chrono::steady_clock::duration TimeCalibrationQueries(AbstractSearch<L>& search, const std::vector<Offset2D>& sampledVertices) const;
+
+    static constexpr int calibrationQueryCount = 16;  // The number of sampled queries in a calibration run.
+
     std::unique_ptr<AbstractSearch<L>> searchPtr_{};
     std::unique_ptr<AbstractSmoothing<L>> smoothingPtr_{};
+    ContractionHierarchySearch<L>* hierarchySearchPtr_{};  // The search object, if the contraction hierarchy search method is used.
     bool centralize_;
     bool fromSource_;
+    int blockSize_;
+    PathCost jumpCost_;
+    int64_t smoothingTime_;
 };
 
 template <int L>
@@ -84,32 +205,218 @@ PathPlanner<L>::PathPlanner(const std::vector<std::vector<bool>>& inputCells,
                             SearchMethod searchMethod,
                             SmoothingMethod smoothingMethod,
                             bool centralize,
-                            bool fromSource)
+                            bool fromSource,
+                            int blockSize,
+                            int threadCount)
     : centralize_{ centralize }
     , fromSource_{ fromSource }
+    , blockSize_{ 0 }
+    , jumpCost_{}
+    , smoothingTime_{ 0 }
 {
     Grid2D<L> grid{ inputCells, alignment };
+    if (searchMethod == SearchMethod::MixedAStar) {
+        blockSize_ = (blockSize == autoBlockSize) ? CalibrateBlockSize<MixedAStarSearch>(grid) : blockSize;
+    }
+    if (searchMethod == SearchMethod::MixedJumpPoint) {
+        blockSize_ = (blockSize == autoBlockSize) ? CalibrateBlockSize<MixedJumpPointSearch>(grid) : blockSize;
+    }
+    if (searchMethod == SearchMethod::JumpPoint) {
+        jumpCost_ = PathCost::MaxCost();
+    }
+    if (searchMethod == SearchMethod::BoundedJumpPoint) {
+        jumpCost_ = boundedJumpCost;
+    }
+    if (searchMethod == SearchMethod::AdaptiveBoundedJumpPoint) {
+        jumpCost_ = CalibrateJumpCost(grid);
+    }
     switch (searchMethod) {
-    case SearchMethod::AStar:            searchPtr_ = std::make_unique<         AStarSearch<L>>(grid);              break;
-    case SearchMethod::JumpPoint:        searchPtr_ = std::make_unique<     JumpPointSearch<L>>(grid);              break;
-    case SearchMethod::BoundedJumpPoint: searchPtr_ = std::make_unique<     JumpPointSearch<L>>(grid, PathCost(8)); break;
-    case SearchMethod::MixedAStar:       searchPtr_ = std::make_unique<    MixedAStarSearch<L>>(grid);              break;
-    case SearchMethod::MixedJumpPoint:   searchPtr_ = std::make_unique<MixedJumpPointSearch<L>>(grid);              break;
+    case SearchMethod::AStar:                    searchPtr_ = std::make_unique<         AStarSearch<L>>(grid);                        break;
+    case SearchMethod::JumpPoint:                searchPtr_ = std::make_unique<     JumpPointSearch<L>>(grid);                        break;
+    case SearchMethod::BoundedJumpPoint:         searchPtr_ = std::make_unique<     JumpPointSearch<L>>(grid, jumpCost_);             break;
+    case SearchMethod::MixedAStar:               searchPtr_ = CreateMixedSearch<    MixedAStarSearch>(grid, blockSize_, threadCount); break;
+    case SearchMethod::MixedJumpPoint:           searchPtr_ = CreateMixedSearch<MixedJumpPointSearch>(grid, blockSize_);              break;
+    case SearchMethod::Incremental:              searchPtr_ = std::make_unique<   IncrementalSearch<L>>(grid);                        break;
+    case SearchMethod::AdaptiveBoundedJumpPoint: searchPtr_ = std::make_unique<     JumpPointSearch<L>>(grid, jumpCost_, true);       break;
+    case SearchMethod::SubgoalGraph:             searchPtr_ = CreateSubgoalGraphSearch(grid);                                     break;
+    case SearchMethod::ContractionHierarchy:     searchPtr_ = CreateContractionHierarchySearch(grid, ContractionHierarchy<L>{ grid }); break;
+    case SearchMethod::CompressedPathDatabase:   searchPtr_ = std::make_unique<CompressedPathDatabaseSearch<L>>(grid, centralize, threadCount); break;
     }
-    switch (smoothingMethod) {
-    case SmoothingMethod::No:       smoothingPtr_ = std::make_unique<      NoSmoothing<L>>(grid); break;
-    case SmoothingMethod::Greedy:   smoothingPtr_ = std::make_unique<  GreedySmoothing<L>>(grid); break;
-    case SmoothingMethod::Tentpole: smoothingPtr_ = std::make_unique<TentpoleSmoothing<L>>(grid); break;
+    smoothingPtr_ = CreateSmoothing(grid, smoothingMethod);
+    assert(searchPtr_);
+    assert(smoothingPtr_);
+}
+
+template <int L>
+PathPlanner<L>::PathPlanner(const std::vector<std::vector<bool>>& inputCells,
+                            CellAlignment alignment,
+                            std::istream& hierarchyStream,
+                            SmoothingMethod smoothingMethod,
+                            bool centralize,
+                            bool fromSource)
+    : centralize_{ centralize }
+    , fromSource_{ fromSource }
+    , blockSize_{ 0 }
+    , jumpCost_{}
+    , smoothingTime_{ 0 }
+{
+    Grid2D<L> grid{ inputCells, alignment };
+    ContractionHierarchy<L> hierarchy{};
+    if (!hierarchy.Read(hierarchyStream, grid)) {
+        hierarchy = ContractionHierarchy<L>{ grid };
     }
+    searchPtr_ = CreateContractionHierarchySearch(grid, std::move(hierarchy));
+    smoothingPtr_ = CreateSmoothing(grid, smoothingMethod);
     assert(searchPtr_);
     assert(smoothingPtr_);
 }
 
+template <int L>
+template <template <int, int> class MixedSearchType, typename... Args>
+std::unique_ptr<AbstractSearch<L>> PathPlanner<L>::CreateMixedSearch(const Grid2D<L>& grid, int blockSize, Args... args)
+{
+    std::unique_ptr<AbstractSearch<L>> searchPtr{};
+    switch (blockSize) {
+    case  1: searchPtr = std::make_unique<MixedSearchType<L,  1>>(grid, args...); break;
+    case  2: searchPtr = std::make_unique<MixedSearchType<L,  2>>(grid, args...); break;
+    case  4: searchPtr = std::make_unique<MixedSearchType<L,  4>>(grid, args...); break;
+    case  8: searchPtr = std::make_unique<MixedSearchType<L,  8>>(grid, args...); break;
+    case 16: searchPtr = std::make_unique<MixedSearchType<L, 16>>(grid, args...); break;
+    case 32: searchPtr = std::make_unique<MixedSearchType<L, 32>>(grid, args...); break;
+    case 64: searchPtr = std::make_unique<MixedSearchType<L, 64>>(grid, args...); break;
+    default: throw std::invalid_argument("The block size of a mixed search method must be 1, 2, 4, 8, 16, 32, or 64.");
+    }
+    return searchPtr;
+}
+
+template <int L>
+std::unique_ptr<AbstractSearch<L>> PathPlanner<L>::CreateSubgoalGraphSearch(const Grid2D<L>& grid)
+{
+    std::unique_ptr<AbstractSearch<L>> searchPtr{};
+    if constexpr (L == 8 || L == 16) {
+        searchPtr = std::make_unique<SubgoalGraphSearch<L>>(grid);
+    }
+    else {
+        // Reject the method even in release builds, where a null search object would otherwise be dereferenced later.
+        throw std::invalid_argument("The subgoal graph search method requires an 8- or 16-neighbor grid.");
+    }
+    return searchPtr;
+}
+
+template <int L>
+std::unique_ptr<AbstractSearch<L>> PathPlanner<L>::CreateContractionHierarchySearch(const Grid2D<L>& grid, ContractionHierarchy<L> hierarchy)
+{
+    auto searchPtr = std::make_unique<ContractionHierarchySearch<L>>(grid, std::move(hierarchy));
+    hierarchySearchPtr_ = searchPtr.get();
+    return searchPtr;
+}
+
+template <int L>
+std::unique_ptr<AbstractSmoothing<L>> PathPlanner<L>::CreateSmoothing(const Grid2D<L>& grid, SmoothingMethod smoothingMethod)
+{
+    std::unique_ptr<AbstractSmoothing<L>> smoothingPtr{};
+    switch (smoothingMethod) {
+    case SmoothingMethod::No:       smoothingPtr = std::make_unique<      NoSmoothing<L>>(grid); break;
+    case SmoothingMethod::Greedy:   smoothingPtr = std::make_unique<  GreedySmoothing<L>>(grid); break;
+    case SmoothingMethod::Tentpole: smoothingPtr = std::make_unique<TentpoleSmoothing<L>>(grid); break;
+    }
+    return smoothingPtr;
+}
+
+template <int L>
+template <template <int, int> class MixedSearchType>
+int PathPlanner<L>::CalibrateBlockSize(const Grid2D<L>& grid) const
+{
+    // Time each block size on the same sampled queries. Give up on maps with too few connected vertices.
+    int fastestBlockSize = 8;
+    const std::vector<Offset2D> sampledVertices = SampleCalibrationVertices(grid);
+    if (!sampledVertices.empty()) {
+        std::chrono::steady_clock::duration fastestDuration = std::chrono::steady_clock::duration::max();
+        for (int blockSize : { 1, 2, 4, 8, 16, 32, 64 }) {
+            std::unique_ptr<AbstractSearch<L>> searchPtr = CreateMixedSearch<MixedSearchType>(grid, blockSize);
+            const std::chrono::steady_clock::duration duration = TimeCalibrationQueries(*searchPtr, sampledVertices);
+            if (duration < fastestDuration) {
+                fastestDuration = duration;
+                fastestBlockSize = blockSize;
+            }
+        }
+    }
+    return fastestBlockSize;
+}
+
+template <int L>
+PathCost PathPlanner<L>::CalibrateJumpCost(const Grid2D<L>& grid) const
+{
+    // Time each jump cost on the same sampled queries. Give up on maps with too few connected vertices.
+    PathCost fastestJumpCost = boundedJumpCost;
+    const std::vector<Offset2D> sampledVertices = SampleCalibrationVertices(grid);
+    if (!sampledVertices.empty()) {
+        std::chrono::steady_clock::duration fastestDuration = std::chrono::steady_clock::duration::max();
+        for (double jumpCost : calibrationJumpCosts) {
+            JumpPointSearch<L> search{ grid, PathCost(jumpCost) };
+            const std::chrono::steady_clock::duration duration = TimeCalibrationQueries(search, sampledVertices);
+            if (duration < fastestDuration) {
+                fastestDuration = duration;
+                fastestJumpCost = PathCost(jumpCost);
+            }
+        }
+    }
+    return fastestJumpCost;
+}
+
+template <int L>
+std::vector<Offset2D> PathPlanner<L>::SampleCalibrationVertices(const Grid2D<L>& grid) const
+{
+    // Sample pairs of vertices that have at least one connection, using a fixed seed so that
+    // every calibration of the same map uses the same queries.
+    std::vector<Offset2D> sampledVertices{};
+    std::mt19937 generator{ 0 };
+    std::uniform_int_distribution<int> xDistribution{ 0, std::max(0, grid.Dims().X() - 1) };
+    std::uniform_int_distribution<int> yDistribution{ 0, std::max(0, grid.Dims().Y() - 1) };
+    for (int attempt = 0; attempt < 64*calibrationQueryCount && int(sampledVertices.size()) < 2*calibrationQueryCount; ++attempt) {
+        const Offset2D coords{ xDistribution(generator), yDistribution(generator) };
+        if (grid.Contains(coords) && !grid.Neighbors(coords).IsAllDisconnected()) {
+            sampledVertices.push_back(coords);
+        }
+    }
+    if (int(sampledVertices.size()) < 2*calibrationQueryCount) {
+        sampledVertices.clear();
+    }
+    return sampledVertices;
+}
+
+template <int L>
+std::chrono::steady_clock::duration PathPlanner<L>::TimeCalibrationQueries(AbstractSearch<L>& search, const std::vector<Offset2D>& sampledVertices) const
+{
+    std::chrono::steady_clock::time_point start{};
+    for (int run = 0; run < 2; ++run) {
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < calibrationQueryCount; ++i) {
+            search.PlanGridPath(sampledVertices[2*i], sampledVertices[2*i + 1], centralize_, fromSource_);
+        }
+    }
+    return std::chrono::steady_clock::now() - start;
+}
+
 template <int L>
 std::vector<Offset2D> PathPlanner<L>::PlanPath(Offset2D sourceCoords, Offset2D sampleCoords)
 {
     std::vector<Offset2D> pathVertices = searchPtr_->PlanGridPath(sourceCoords, sampleCoords, centralize_, fromSource_);
-    smoothingPtr_->SmoothPath(pathVertices);
+    {
+        StageTimer timer{ smoothingTime_ };
+        smoothingPtr_->SmoothPath(pathVertices);
+    }
+    return pathVertices;
+}
+
+template <int L>
+std::vector<Offset2D> PathPlanner<L>::PlanPath(const std::vector<Offset2D>& sourceCoords, const std::vector<Offset2D>& sampleCoords)
+{
+    std::vector<Offset2D> pathVertices = searchPtr_->PlanGridPath(sourceCoords, sampleCoords, centralize_, fromSource_);
+    {
+        StageTimer timer{ smoothingTime_ };
+        smoothingPtr_->SmoothPath(pathVertices);
+    }
     return pathVertices;
 }
 
@@ -119,14 +426,68 @@ void PathPlanner<L>::SearchAllNodes(Offset2D sourceCoords)
     searchPtr_->SearchAllNodes(sourceCoords);
 }
 
+template <int L>
+void PathPlanner<L>::SearchWithinCost(Offset2D sourceCoords, PathCost maxCost)
+{
+    searchPtr_->SearchWithinCost(sourceCoords, maxCost);
+}
+
 template <int L>
 std::vector<Offset2D> PathPlanner<L>::SamplePath(Offset2D sampleCoords)
 {
     std::vector<Offset2D> pathVertices = searchPtr_->SampleGridPath(sampleCoords, centralize_, fromSource_);
-    smoothingPtr_->SmoothPath(pathVertices);
+    {
+        StageTimer timer{ smoothingTime_ };
+        smoothingPtr_->SmoothPath(pathVertices);
+    }
     return pathVertices;
 }
 
+template <int L>
+std::vector<Offset2D> PathPlanner<L>::UpdateCells(Offset2D cellCoords, const std::vector<std::vector<bool>>& regionCells)
+{
+    smoothingPtr_->UpdateCells(cellCoords, regionCells);
+    return searchPtr_->UpdateCells(cellCoords, regionCells);
+}
+
+template <int L>
+void PathPlanner<L>::WriteHierarchy(std::ostream& stream)
+{
+    assert(hierarchySearchPtr_);  // The planner must use the contraction hierarchy search method.
+    hierarchySearchPtr_->UpdateHierarchy();
+    hierarchySearchPtr_->Hierarchy().Write(stream);
+}
+
+template <int L>
+StageTimes PathPlanner<L>::Times() const
+{
+    StageTimes times = searchPtr_->Times();
+    times.smoothing = smoothingTime_;
+    return times;
+}
+
+template <int L>
+void PathPlanner<L>::ResetTimes()
+{
+    searchPtr_->ResetTimes();
+    smoothingTime_ = 0;
+}
+
+template <int L>
+SearchStatistics PathPlanner<L>::Statistics() const
+{
+    SearchStatistics statistics = searchPtr_->Statistics();
+    statistics += smoothingPtr_->Statistics();
+    return statistics;
+}
+
+template <int L>
+void PathPlanner<L>::ResetStatistics()
+{
+    searchPtr_->ResetStatistics();
+    smoothingPtr_->ResetStatistics();
+}
+
 /// Create the recommended 4-neighbor path planner.
 inline PathPlanner<4> CreateBestPathPlanner4(const std::vector<std::vector<bool>>& inputCells,
                                              CellAlignment alignment = CellAlignment::Center,
@@ -4,63 +4,104 @@
 
 #include <central64/grid/Offset2D.hpp>
 
+/// Define `CENTRAL64_TILE_SIZE` as 2, 4, 8, 16, 32, or 64 to store the arrays that are accessed during searches
+/// (the connections of the grid, the nodes of the path tree, and the arrays of the path flow) in square tiles.
+/// By default these arrays are stored in row-major order.
+#ifndef CENTRAL64_TILE_SIZE
+#define CENTRAL64_TILE_SIZE 1
+#endif
+
 namespace central64 {
 
-/// A 2D array data structure for elements of type `T`.
-template <typename T>
+/// A 2D array data structure for elements of type `T`, stored in `B`-by-`B` tiles.
+/// Elements within a tile are contiguous, so moves of a few vertices in any direction tend to stay within
+/// the same cache lines. The tiles themselves, and the elements within each tile, are in row-major order.
+/// If `B` is 1, the entire array is stored in row-major order.
+template <typename T, int B = 1>
 class Array2D
 {
+    static_assert(B == 1 || B == 2 || B == 4 || B == 8 || B == 16 || B == 32 || B == 64,
+                  "Tile size must be 1, 2, 4, 8, 16, 32, or 64.");
+
 public:
     using Reference = typename std::vector<T>::reference;             ///< The reference type for an individual array element.
     using ConstReference = typename std::vector<T>::const_reference;  ///< The const reference type for an individual array element.
 
-    Array2D() {}                             ///< Create a 2D array with dimensions [0, 0].
-    Array2D(Offset2D dims);                  ///< Create a 2D array with dimensions `dims`.
-    Array2D(Offset2D dims, const T& value);  ///< Create a 2D array with dimensions `dims` and all elements set to `value`.
+    Array2D() {}                                         ///< Create a 2D array with dimensions [0, 0].
+    Array2D(Offset2D dims);                              ///< Create a 2D array with dimensions `dims`.
+    Array2D(Offset2D dims, const T& value);              ///< Create a 2D array with dimensions `dims` and all elements set to `value`.
+    Array2D(Offset2D dims, int border, const T& value);  ///< Create a 2D array with dimensions `dims`, surrounded by a guard band `border` elements wide, with all elements (including the guard band) set to `value`.
 
-    void Fill(const T& value);  ///< Set every element to `value`.
+    void Fill(const T& value);  ///< Set every element, including any guard band, to `value`.
 
     Offset2D Dims() const { return dims_; }           ///< Get the dimensions.
     int Size() const { return dims_.X()*dims_.Y(); }  ///< Get the total number of elements.
 
-    bool Contains(Offset2D coords) const;  ///< Check whether coordinates `coords` are within the array.
+    bool Contains(Offset2D coords) const;           ///< Check whether coordinates `coords` are within the array.
+    bool ContainsWithBorder(Offset2D coords) const;  ///< Check whether coordinates `coords` are within the array or its guard band, and can therefore be accessed.
+
+    int Border() const { return border_; }  ///< Get the width of the guard band surrounding the array.
+
+    Reference operator[](Offset2D coords);             ///< Obtain a reference to the element at coordinates `coords`, which may be in the guard band.
+    ConstReference operator[](Offset2D coords) const;  ///< Obtain a const reference to the element at coordinates `coords`, which may be in the guard band.
+
+    static constexpr bool IsRowMajor() { return B == 1; }  ///< Check whether the array is stored in row-major order, so that the index offset of each 2D offset is constant.
 
-    Reference operator[](Offset2D coords);             ///< Obtain a reference to the element at coordinates `coords`.
-    ConstReference operator[](Offset2D coords) const;  ///< Obtain a const reference to the element at coordinates `coords`.
+    int Index(Offset2D coords) const;  ///< Get the linear index of the element at coordinates `coords`, its position in the underlying storage.
+
+    Reference operator[](int index);             ///< Obtain a reference to the element at linear index `index`.
+    ConstReference operator[](int index) const;  ///< Obtain a const reference to the element at linear index `index`.
 
 private:
+    static constexpr int tileBits = (B == 1) ? 0 : (B == 2) ? 1 : (B == 4) ? 2 : (B == 8) ? 3 : (B == 16) ? 4 : (B == 32) ? 5 : 6;  // The base-2 logarithm of the tile size.
+
+    // Compute the number of elements to store, including the padding of partial tiles.
+    static int StorageSize(Offset2D dims);
+
+    // Set the dimensions and guard band width, and compute the layout of the underlying storage.
+    void SetLayout(Offset2D dims, int border);
+
     Offset2D dims_{ 0, 0 };
+    int border_{ 0 };
+    int storageWidth_{ 0 };  // The number of stored elements in each row, including the guard band and the padding of partial tiles.
+    int originIndex_{ 0 };   // The linear index of the element at coordinates [0, 0], used in row-major order.
+    int tileCountX_{ 0 };
     std::vector<T> data_{};
 };
 
+/// A 2D array stored in the tile size selected by `CENTRAL64_TILE_SIZE`, used for arrays that are accessed during searches.
 template <typename T>
-Array2D<T>::Array2D(Offset2D dims)
-{
-    assert(dims.X() >= 0);
-    assert(dims.Y() >= 0);
+using TiledArray2D = Array2D<T, CENTRAL64_TILE_SIZE>;
 
-    dims_ = dims;
-    data_.resize(dims_.X()*dims_.Y());
+template <typename T, int B>
+Array2D<T, B>::Array2D(Offset2D dims)
+{
+    SetLayout(dims, 0);
+    data_.resize(StorageSize(dims_ + Offset2D{ 2*border_, 2*border_ }));
 }
 
-template <typename T>
-Array2D<T>::Array2D(Offset2D dims, const T& value)
+template <typename T, int B>
+Array2D<T, B>::Array2D(Offset2D dims, const T& value)
 {
-    assert(dims.X() >= 0);
-    assert(dims.Y() >= 0);
+    SetLayout(dims, 0);
+    data_.assign(StorageSize(dims_ + Offset2D{ 2*border_, 2*border_ }), value);
+}
 
-    dims_ = dims;
-    data_.assign(dims_.X()*dims_.Y(), value);
+template <typename T, int B>
+Array2D<T, B>::Array2D(Offset2D dims, int border, const T& value)
+{
+    SetLayout(dims, border);
+    data_.assign(StorageSize(dims_ + Offset2D{ 2*border_, 2*border_ }), value);
 }
 
-template <typename T>
-void Array2D<T>::Fill(const T& value)
+template <typename T, int B>
+void Array2D<T, B>::Fill(const T& value)
 {
-    data_.assign(dims_.X()*dims_.Y(), value);
+    data_.assign(StorageSize(dims_ + Offset2D{ 2*border_, 2*border_ }), value);
 }
 
-template <typename T>
-inline bool Array2D<T>::Contains(Offset2D coords) const
+template <typename T, int B>
+inline bool Array2D<T, B>::Contains(Offset2D coords) const
 {
     return (coords.X() >= 0) &&
            (coords.Y() >= 0) &&
@@ -68,20 +109,88 @@ inline bool Array2D<T>::Contains(Offset2D coords) const
            (coords.Y() < dims_.Y());
 }
 
-template <typename T>
-inline typename Array2D<T>::Reference Array2D<T>::operator[](Offset2D coords)
+template <typename T, int B>
+inline bool Array2D<T, B>::ContainsWithBorder(Offset2D coords) const
 {
-    assert(Contains(coords));
+    return (coords.X() >= -border_) &&
+           (coords.Y() >= -border_) &&
+           (coords.X() < dims_.X() + border_) &&
+           (coords.Y() < dims_.Y() + border_);
+}
+
+template <typename T, int B>
+inline typename Array2D<T, B>::Reference Array2D<T, B>::operator[](Offset2D coords)
+{
+    assert(ContainsWithBorder(coords));
 
-    return data_[coords.Y()*dims_.X() + coords.X()];
+    return data_[Index(coords)];
 }
 
-template <typename T>
-inline typename Array2D<T>::ConstReference Array2D<T>::operator[](Offset2D coords) const
+template <typename T, int B>
+inline typename Array2D<T, B>::ConstReference Array2D<T, B>::operator[](Offset2D coords) const
 {
-    assert(Contains(coords));
+    assert(ContainsWithBorder(coords));
 
-    return data_[coords.Y()*dims_.X() + coords.X()];
+    return data_[Index(coords)];
+}
+
+template <typename T, int B>
+inline typename Array2D<T, B>::Reference Array2D<T, B>::operator[](int index)
+{
+    assert(index >= 0 && index < int(data_.size()));
+
+    return data_[index];
+}
+
+template <typename T, int B>
+inline typename Array2D<T, B>::ConstReference Array2D<T, B>::operator[](int index) const
+{
+    assert(index >= 0 && index < int(data_.size()));
+
+    return data_[index];
+}
+
+template <typename T, int B>
+inline int Array2D<T, B>::StorageSize(Offset2D dims)
+{
+    if constexpr (B == 1) {
+        return dims.X()*dims.Y();
+    }
+    else {
+        return (((dims.X() + B - 1) >> tileBits) << tileBits)*(((dims.Y() + B - 1) >> tileBits) << tileBits);
+    }
+}
+
+template <typename T, int B>
+inline int Array2D<T, B>::Index(Offset2D coords) const
+{
+    assert(ContainsWithBorder(coords));
+
+    if constexpr (B == 1) {
+        return originIndex_ + coords.Y()*storageWidth_ + coords.X();
+    }
+    else {
+        // Locate the tile, then the element within the tile, relative to the lower corner of the guard band.
+        const int x = coords.X() + border_;
+        const int y = coords.Y() + border_;
+        const int tileIndex = (y >> tileBits)*tileCountX_ + (x >> tileBits);
+        const int innerIndex = ((y & (B - 1)) << tileBits) + (x & (B - 1));
+        return (tileIndex << (2*tileBits)) + innerIndex;
+    }
+}
+
+template <typename T, int B>
+inline void Array2D<T, B>::SetLayout(Offset2D dims, int border)
+{
+    assert(dims.X() >= 0);
+    assert(dims.Y() >= 0);
+    assert(border >= 0);
+
+    dims_ = dims;
+    border_ = border;
+    tileCountX_ = (dims_.X() + 2*border_ + B - 1) >> tileBits;
+    storageWidth_ = tileCountX_ << tileBits;
+    originIndex_ = border_*storageWidth_ + border_;
 }
 
 }  // namespace
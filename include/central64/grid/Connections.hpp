@@ -11,7 +11,25 @@ template <int L>
 class Connections
 {
 public:
-    constexpr Connections() = default;  ///< Create a set of connections for which no moves are connected.
+    /// An iterator over the connected moves, visited in increasing order of move index.
+    /// Each step finds the lowest remaining set bit, so disconnected moves are skipped without being examined.
+    class Iterator
+    {
+    public:
+        constexpr explicit Iterator(typename Unsigned<L>::type flags) : flags_{ flags } {}  ///< Create an iterator over the moves whose bits are set in `flags`.
+
+        const Move<L>& operator*() const { return Neighborhood<L>::Moves()[CountTrailingZeros(flags_)]; }  ///< Get the connected move with the lowest remaining index.
+        Iterator& operator++() { flags_ = typename Unsigned<L>::type(flags_ & (flags_ - 1)); return *this; }  ///< Advance to the connected move with the next index.
+
+        constexpr bool operator==(Iterator rhs) const { return flags_ == rhs.flags_; }  ///< Check whether two iterators are equal.
+        constexpr bool operator!=(Iterator rhs) const { return flags_ != rhs.flags_; }  ///< Check whether two iterators are different.
+
+    private:
+        typename Unsigned<L>::type flags_;  // The flags of the connected moves that have not yet been visited.
+    };
+
+    constexpr Connections() = default;                                                       ///< Create a set of connections for which no moves are connected.
+    constexpr explicit Connections(typename Unsigned<L>::type flags) : flags_{ flags } {}  ///< Create a set of connections in which bit `i` of `flags` indicates whether the move with index `i` is connected.
 
     constexpr bool IsConnected(const Move<L>& move) const { return bool(flags_ & (Unsigned<L>::unit << move.Index())); }  ///< Check whether the specified `move` is connected.
     constexpr bool IsAllConnected() const { return bool(flags_ == Unsigned<L>::max); }                                    ///< Check whether all moves are connected.
@@ -28,13 +46,15 @@ public:
     constexpr const Connections& operator&=(Offset2D rhs) { *this = *this & rhs; return *this; }  ///< Intersect with the sets of connections on the right-hand side.
     constexpr const Connections& operator|=(Offset2D rhs) { *this = *this | rhs; return *this; }  ///< Union with the sets of connections on the right-hand side.
 
+    constexpr typename Unsigned<L>::type Flags() const { return flags_; }  ///< Get the unsigned integer in which bit `i` indicates whether the move with index `i` is connected.
+
     constexpr bool operator==(Connections rhs) const { return flags_ == rhs.flags_; }  ///< Check whether two sets of connections are equal.
     constexpr bool operator!=(Connections rhs) const { return flags_ != rhs.flags_; }  ///< Check whether two sets of connections are different.
 
-private:
-    // Create a set of connections directly from an unsigned integer representing a set of flags.
-    Connections(typename Unsigned<L>::type flags) : flags_{ flags } {}
+    constexpr Iterator begin() const { return Iterator{ flags_ }; }              ///< Get an iterator to the connected move with the lowest index.
+    constexpr Iterator end() const { return Iterator{ Unsigned<L>::zero }; }  ///< Get the iterator that follows the last connected move.
 
+private:
     typename Unsigned<L>::type flags_ = Unsigned<L>::zero;
 };
 
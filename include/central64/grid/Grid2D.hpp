@@ -4,6 +4,15 @@
 
 #include <central64/grid/Array2D.hpp>
 #include <central64/grid/Connections.hpp>
+#include <map>
+
+/// Define `CENTRAL64_GUARD_BAND` as 1 to surround the grid cells with a band of obstructed cells
+/// as wide as the neighborhood radius, so that the connections of each vertex are computed
+/// without checking whether each neighbor is within the grid.
+/// By default the cells are stored without a guard band, and neighbors outside the grid are skipped.
+#ifndef CENTRAL64_GUARD_BAND
+#define CENTRAL64_GUARD_BAND 0
+#endif
 
 namespace central64 {
 
@@ -29,12 +38,16 @@ public:
 
     const Array2D<bool>& CenterCells() { return centerCells_; }        ///< Obtain a const reference to the array of center-aligned cells.
     const Array2D<bool>& CornerCells() { return cornerCells_; }        ///< Obtain a const reference to the array of corner-aligned cells.
-    const Array2D<Connections<L>>& GridGraph() { return gridGraph_; }  ///< Obtain a const reference to the array of sets of connections.
+    const TiledArray2D<Connections<L>>& GridGraph() { return gridGraph_; }  ///< Obtain a const reference to the array of sets of connections.
 
     bool CenterCell(Offset2D coords) const { return centerCells_[coords]; }  ///< Check whether the center-aligned cell at coordinates `coords` is obstructed.
     bool CornerCell(Offset2D coords) const { return cornerCells_[coords]; }  ///< Check whether the corner-aligned cell at coordinates `coords` is obstructed.
 
     Connections<L> Neighbors(Offset2D coords) const { return gridGraph_[coords]; }  ///< Get the set of connections for the vertex at coordinates `coords`.
+    Connections<L> Neighbors(int index) const { return gridGraph_[index]; }         ///< Get the set of connections for the vertex at linear index `index`.
+
+    int Index(Offset2D coords) const { return gridGraph_.Index(coords); }  ///< Get the linear index of the vertex at coordinates `coords`, which is shared by all tiled arrays with the grid dimensions.
+    int NeighborIndex(Offset2D coords, int index, const Move<L>& move) const;  ///< Get the linear index of the neighbor in the direction `move` of the vertex at coordinates `coords` and linear index `index`.
 
     bool Contains(Offset2D coords) const { return gridGraph_.Contains(coords); }  ///< Check whether vertex coordinates `coords` are within the grid.
     bool LineOfSight(Offset2D coordsA, Offset2D coordsB) const;                   ///< Computer whether there is an unobstructed line-of-sight connection between coordinates `coordsA` and `coordsB`.
@@ -42,11 +55,52 @@ public:
     Connections<L> CanonicalSuccessors(Offset2D coords, const Move<L>& parentMove) const;  ///< Compute the set of canonical successors at coordinates `coords` if the parent vertex is in the direction `parentMove`.
     Connections<L> ForcedSuccessors(Offset2D coords, const Move<L>& parentMove) const;     ///< Compute the set of forced successors at coordinates `coords` if the parent vertex is in the direction `parentMove`.
 
+    /// Precompute the canonical and forced successors of every vertex for every parent move, so that `CanonicalSuccessors`
+    /// and `ForcedSuccessors` look them up rather than scanning the neighborhood. The successors depend only on the vertex's
+    /// connections (and, for the 4-neighborhood, the surrounding corner-aligned cells), so each distinct local pattern is
+    /// computed once and its table is shared. `UpdateCells` keeps the tables current, but they are intended for static maps.
+    void PrecomputeSuccessors();
+    bool HasPrecomputedSuccessors() const { return !successorTables_.empty(); }  ///< Check whether the successors have been precomputed.
+
+    Offset2D InputDims() const;  ///< Get the number of input cells in each dimension, which depends on the cell alignment.
+
+    /// Replace the rectangular region of input cells whose lowest coordinates are `cellCoords` with `regionCells`,
+    /// using the same convention as the `inputCells` supplied to the constructor. The derived cells are recomputed,
+    /// along with the connections of the vertices within a neighborhood radius of the region. Return the coordinates
+    /// of every vertex whose set of connections has changed.
+    std::vector<Offset2D> UpdateCells(Offset2D cellCoords, const std::vector<std::vector<bool>>& regionCells);
+
+    std::vector<Offset2D> SetObstacle(Offset2D cellCoords) { return UpdateCells(cellCoords, {{ true }}); }     ///< Obstruct the input cell at coordinates `cellCoords`, and return the coordinates of every vertex whose set of connections has changed.
+    std::vector<Offset2D> ClearObstacle(Offset2D cellCoords) { return UpdateCells(cellCoords, {{ false }}); }  ///< Clear the input cell at coordinates `cellCoords`, and return the coordinates of every vertex whose set of connections has changed.
+
 private:
+    static constexpr int guardBand = (CENTRAL64_GUARD_BAND != 0) ? Neighborhood<L>::Radius() : 0;  // The width of the band of obstructed cells surrounding the grid.
+
+    // Use line-of-sight checks to compute the connections between the vertex at coordinates `coords` and its neighbors.
+    Connections<L> ComputeNeighbors(Offset2D coords) const;
+
+    // Compute the set of canonical or forced successors at coordinates `coords` if the parent vertex is in the direction `parentMove`.
+    Connections<L> ComputeCanonicalSuccessors(Offset2D coords, const Move<L>& parentMove) const;
+    Connections<L> ComputeForcedSuccessors(Offset2D coords, const Move<L>& parentMove) const;
+
+    // Obtain the index of the successor table for the vertex at coordinates `coords`, computing a new table if the
+    // local pattern of connections and obstructed cells has not been encountered before.
+    int SuccessorTableIndex(Offset2D coords);
+
+    // The canonical and forced successors of a vertex for one parent move.
+    struct JumpSuccessors {
+        Connections<L> canonical{};
+        Connections<L> forced{};
+    };
+
     CellAlignment alignment_;
     Array2D<bool> centerCells_;
     Array2D<bool> cornerCells_;
-    Array2D<Connections<L>> gridGraph_;
+    TiledArray2D<Connections<L>> gridGraph_;
+    std::array<int, L> moveIndexOffsets_;  // The linear index offset of each move, used if the arrays are stored in row-major order.
+    std::vector<std::array<JumpSuccessors, L>> successorTables_;  // The successors for each parent move, for each distinct local pattern, if precomputed.
+    std::map<std::pair<uint64_t, int>, int> successorPatterns_;   // The index of the successor table for each local pattern of connections and obstructed cells.
+    TiledArray2D<int> successorTableIndices_;                     // The index of the successor table of each vertex, if the successors are precomputed.
 };
 
 /// Obtain a string representation of the specified `grid`.
@@ -64,8 +118,14 @@ Grid2D<L>::Grid2D(const std::vector<std::vector<bool>>& inputCells,
     , centerCells_{}
     , cornerCells_{}
     , gridGraph_{}
+    , moveIndexOffsets_{}
+    , successorTables_{}
+    , successorPatterns_{}
+    , successorTableIndices_{}
 {
     // Derive and store the dimensions and both center- and corner-aligned cells.
+    // If enabled, both arrays of cells are surrounded by a guard band of obstructed cells,
+    // which blocks every sightline that leaves the grid without the need for boundary checks.
     int nx = 0;
     int ny = 0;
     if (alignment == CellAlignment::Center) {
@@ -76,7 +136,7 @@ Grid2D<L>::Grid2D(const std::vector<std::vector<bool>>& inputCells,
         ny = int(inputCells.size());
         
         // Store the centered-aligned grid cells.
-        centerCells_ = Array2D<bool>{ {nx, ny}, false };
+        centerCells_ = Array2D<bool>{ {nx, ny}, guardBand, true };
         for (int y = 0; y < ny; ++y) {
             assert(int(inputCells[y].size()) == nx);
             for (int x = 0; x < nx; ++x) {
@@ -87,7 +147,7 @@ Grid2D<L>::Grid2D(const std::vector<std::vector<bool>>& inputCells,
         // Derive the corner-aligned grid cells.
         // Each corner-aligned cell is obstructed if any of the
         // overlappning center-aligned cells are obstructed.
-        cornerCells_ = Array2D<bool>{ {nx - 1, ny - 1}, false };
+        cornerCells_ = Array2D<bool>{ {nx - 1, ny - 1}, guardBand, true };
         for (int y = 0; y < ny - 1; ++y) {
             for (int x = 0; x < nx - 1; ++x) {
                 cornerCells_[{x, y}] = inputCells[y][x] || inputCells[y][x + 1] ||
@@ -105,8 +165,8 @@ Grid2D<L>::Grid2D(const std::vector<std::vector<bool>>& inputCells,
         // Store the corner-aligned grid cells and derive the center-aligned grid cells.
         // Each center-aligned cell is obstructed if all of the
         // overlappning corner-aligned cells are obstructed.
-        centerCells_ = Array2D<bool>{ {nx, ny}, true };
-        cornerCells_ = Array2D<bool>{ {nx - 1, ny - 1}, false };
+        centerCells_ = Array2D<bool>{ {nx, ny}, guardBand, true };
+        cornerCells_ = Array2D<bool>{ {nx - 1, ny - 1}, guardBand, true };
         for (int y = 0; y < ny - 1; ++y) {
             assert(int(inputCells[y].size()) == nx - 1);
             for (int x = 0; x < nx - 1; ++x) {
@@ -120,28 +180,147 @@ Grid2D<L>::Grid2D(const std::vector<std::vector<bool>>& inputCells,
     }
 
     // Use line-of-sight checks to populate a graph of connections among neighboring grid vertices.
-    gridGraph_ = Array2D<Connections<L>>{ {nx, ny} };
+    gridGraph_ = TiledArray2D<Connections<L>>{ {nx, ny} };
     for (int y = 0; y < ny; ++y) {
         for (int x = 0; x < nx; ++x) {
-            const Offset2D coords{ x, y };
-            Connections<L>& neighbors = gridGraph_[coords];
-            for (const Move<L>& move : Neighborhood<L>::Moves()) {
-                const Offset2D neighborCoords = coords + move.Offset();
-                if (Contains(neighborCoords)) {
-                    if (LineOfSight(coords, neighborCoords)) {
-                        neighbors.Connect(move);
+            gridGraph_[{x, y}] = ComputeNeighbors({ x, y });
+        }
+    }
+
+    // Precompute the linear index offset of each move.
+    for (const Move<L>& move : Neighborhood<L>::Moves()) {
+        moveIndexOffsets_[move.Index()] = move.Offset().Y()*nx + move.Offset().X();
+    }
+}
+
+template <int L>
+inline int Grid2D<L>::NeighborIndex(Offset2D coords, int index, const Move<L>& move) const
+{
+    assert(Index(coords) == index);
+    assert(Contains(coords + move.Offset()));
+
+    // In row-major order the index offset of each move is constant, so the neighbor index can be obtained without any multiplication.
+    if constexpr (TiledArray2D<Connections<L>>::IsRowMajor()) {
+        return index + moveIndexOffsets_[move.Index()];
+    }
+    else {
+        return Index(coords + move.Offset());
+    }
+}
+
+template <int L>
+inline Offset2D Grid2D<L>::InputDims() const
+{
+    return (alignment_ == CellAlignment::Center) ? centerCells_.Dims() : cornerCells_.Dims();
+}
+
+template <int L>
+std::vector<Offset2D> Grid2D<L>::UpdateCells(Offset2D cellCoords, const std::vector<std::vector<bool>>& regionCells)
+{
+    std::vector<Offset2D> changedVertices{};
+    if (regionCells.empty() || regionCells[0].empty()) {
+        return changedVertices;
+    }
+
+    // Determine the range of input cells to be replaced.
+    const int x0 = cellCoords.X();
+    const int y0 = cellCoords.Y();
+    const int x1 = x0 + int(regionCells[0].size());
+    const int y1 = y0 + int(regionCells.size());
+    assert(x0 >= 0 && y0 >= 0);
+    assert(x1 <= InputDims().X() && y1 <= InputDims().Y());
+
+    const int nx = Dims().X();
+    const int ny = Dims().Y();
+    if (alignment_ == CellAlignment::Center) {
+        // Store the centered-aligned grid cells.
+        for (int y = y0; y < y1; ++y) {
+            assert(int(regionCells[y - y0].size()) == x1 - x0);
+            for (int x = x0; x < x1; ++x) {
+                centerCells_[{x, y}] = regionCells[y - y0][x - x0];
+            }
+        }
+
+        // Derive the corner-aligned grid cells that overlap the updated center-aligned cells.
+        for (int y = std::max(0, y0 - 1); y < std::min(ny - 1, y1); ++y) {
+            for (int x = std::max(0, x0 - 1); x < std::min(nx - 1, x1); ++x) {
+                cornerCells_[{x, y}] = centerCells_[{x, y}] || centerCells_[{x + 1, y}] ||
+                                       centerCells_[{x, y + 1}] || centerCells_[{x + 1, y + 1}];
+            }
+        }
+    }
+    else {
+        // Store the corner-aligned grid cells.
+        for (int y = y0; y < y1; ++y) {
+            assert(int(regionCells[y - y0].size()) == x1 - x0);
+            for (int x = x0; x < x1; ++x) {
+                cornerCells_[{x, y}] = regionCells[y - y0][x - x0];
+            }
+        }
+
+        // Derive the center-aligned grid cells that overlap the updated corner-aligned cells.
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                bool centerCell = true;
+                for (int cy = std::max(0, y - 1); cy < std::min(ny - 1, y + 1); ++cy) {
+                    for (int cx = std::max(0, x - 1); cx < std::min(nx - 1, x + 1); ++cx) {
+                        centerCell = centerCell && cornerCells_[{cx, cy}];
                     }
                 }
+                centerCells_[{x, y}] = centerCell;
             }
         }
     }
+
+    // Recompute the connections of every vertex with a move that could pass through an updated cell.
+    // A sightline between neighbors never extends beyond the neighborhood radius from either vertex.
+    const int radius = Neighborhood<L>::Radius();
+    for (int y = std::max(0, y0 - 1 - radius); y <= std::min(ny - 1, y1 + radius); ++y) {
+        for (int x = std::max(0, x0 - 1 - radius); x <= std::min(nx - 1, x1 + radius); ++x) {
+            const Offset2D coords{ x, y };
+            const Connections<L> neighbors = ComputeNeighbors(coords);
+            if (neighbors != gridGraph_[coords]) {
+                gridGraph_[coords] = neighbors;
+                changedVertices.push_back(coords);
+            }
+        }
+    }
+
+    // If the successors are precomputed, look up the successor tables of the same vertices, which
+    // covers every vertex whose connections or surrounding corner-aligned cells may have changed.
+    if (HasPrecomputedSuccessors()) {
+        for (int y = std::max(0, y0 - 1 - radius); y <= std::min(ny - 1, y1 + radius); ++y) {
+            for (int x = std::max(0, x0 - 1 - radius); x <= std::min(nx - 1, x1 + radius); ++x) {
+                successorTableIndices_[{ x, y }] = SuccessorTableIndex({ x, y });
+            }
+        }
+    }
+    return changedVertices;
+}
+
+template <int L>
+Connections<L> Grid2D<L>::ComputeNeighbors(Offset2D coords) const
+{
+    // If there is a guard band of obstructed cells, there is no line of sight to a neighbor
+    // outside the grid, so the neighbor need not be checked against the grid boundary.
+    Connections<L> neighbors{};
+    for (const Move<L>& move : Neighborhood<L>::Moves()) {
+        const Offset2D neighborCoords = coords + move.Offset();
+        if (guardBand > 0 || Contains(neighborCoords)) {
+            if (LineOfSight(coords, neighborCoords)) {
+                assert(Contains(neighborCoords));
+                neighbors.Connect(move);
+            }
+        }
+    }
+    return neighbors;
 }
 
 template <int L>
 bool Grid2D<L>::LineOfSight(Offset2D coordsA, Offset2D coordsB) const
 {
     assert(Contains(coordsA));
-    assert(Contains(coordsB));
+    assert(centerCells_.ContainsWithBorder(coordsB));  // The second vertex may be a neighbor outside the grid, within the guard band if there is one.
 
     bool lineOfSight = true;
     if (coordsA.Y() == coordsB.Y()) {
@@ -157,9 +336,10 @@ bool Grid2D<L>::LineOfSight(Offset2D coordsA, Offset2D coordsB) const
             }
         }
         else {
+            // Without a guard band, the cells beyond the edge of the grid are treated as obstructed.
             for (int x = x0; lineOfSight && x < x1; ++x) {
-                const bool lowerCell = (y == 0)              ? true : cornerCells_[{x, y - 1}];
-                const bool upperCell = (y == Dims().Y() - 1) ? true : cornerCells_[{x, y}];
+                const bool lowerCell = (guardBand == 0 && y == 0)              ? true : cornerCells_[{x, y - 1}];
+                const bool upperCell = (guardBand == 0 && y == Dims().Y() - 1) ? true : cornerCells_[{x, y}];
                 lineOfSight = !(lowerCell && upperCell);
             }
         }
@@ -178,9 +358,10 @@ bool Grid2D<L>::LineOfSight(Offset2D coordsA, Offset2D coordsB) const
             }
         }
         else {
+            // Without a guard band, the cells beyond the edge of the grid are treated as obstructed.
             for (int y = y0; lineOfSight && y < y1; ++y) {
-                const bool lowerCell = (x == 0)              ? true : cornerCells_[{x - 1, y}];
-                const bool upperCell = (x == Dims().X() - 1) ? true : cornerCells_[{x, y}];
+                const bool lowerCell = (guardBand == 0 && x == 0)              ? true : cornerCells_[{x - 1, y}];
+                const bool upperCell = (guardBand == 0 && x == Dims().X() - 1) ? true : cornerCells_[{x, y}];
                 // The sightline is still clear if either surrounding cell is traversable.
                 lineOfSight = !(lowerCell && upperCell);
             }
@@ -233,7 +414,65 @@ bool Grid2D<L>::LineOfSight(Offset2D coordsA, Offset2D coordsB) const
 }
 
 template <int L>
-Connections<L> Grid2D<L>::CanonicalSuccessors(Offset2D coords, const Move<L>& parentMove) const
+inline Connections<L> Grid2D<L>::CanonicalSuccessors(Offset2D coords, const Move<L>& parentMove) const
+{
+    return HasPrecomputedSuccessors() ? successorTables_[successorTableIndices_[coords]][parentMove.Index()].canonical :
+                                        ComputeCanonicalSuccessors(coords, parentMove);
+}
+
+template <int L>
+inline Connections<L> Grid2D<L>::ForcedSuccessors(Offset2D coords, const Move<L>& parentMove) const
+{
+    return HasPrecomputedSuccessors() ? successorTables_[successorTableIndices_[coords]][parentMove.Index()].forced :
+                                        ComputeForcedSuccessors(coords, parentMove);
+}
+
+template <int L>
+void Grid2D<L>::PrecomputeSuccessors()
+{
+    successorTables_.clear();
+    successorPatterns_.clear();
+    successorTableIndices_ = TiledArray2D<int>{ Dims() };
+    for (int y = 0; y < Dims().Y(); ++y) {
+        for (int x = 0; x < Dims().X(); ++x) {
+            successorTableIndices_[{ x, y }] = SuccessorTableIndex({ x, y });
+        }
+    }
+}
+
+template <int L>
+int Grid2D<L>::SuccessorTableIndex(Offset2D coords)
+{
+    // Identify the local pattern. For the 4-neighborhood, the forced successors also depend on
+    // the corner-aligned cells wrapped by 90-degree turns, so record each cell that may be checked.
+    int cellFlags = 0;
+    if constexpr (L == 4) {
+        for (const Move<L>& parentMove : Neighborhood<L>::Moves()) {
+            const Move<L> forwardMove = -parentMove;
+            const Move<L> squareTurnPositive = forwardMove + Move<L>::TicksPer90Degrees();
+            const Move<L> squareTurnNegative = forwardMove - Move<L>::TicksPer90Degrees();
+            const int bit = 2*parentMove.Index();
+            cellFlags |= int(cornerCells_[(2*coords + parentMove.Offset() + squareTurnPositive.Offset())/2]) << bit;
+            cellFlags |= int(cornerCells_[(2*coords + parentMove.Offset() + squareTurnNegative.Offset())/2]) << (bit + 1);
+        }
+    }
+    const std::pair<uint64_t, int> pattern{ uint64_t(gridGraph_[coords].Flags()), cellFlags };
+
+    // Compute the successor table the first time the pattern is encountered.
+    const auto [patternIter, inserted] = successorPatterns_.insert({ pattern, int(successorTables_.size()) });
+    if (inserted) {
+        std::array<JumpSuccessors, L> successorTable{};
+        for (const Move<L>& parentMove : Neighborhood<L>::Moves()) {
+            successorTable[parentMove.Index()] = { ComputeCanonicalSuccessors(coords, parentMove),
+                                                   ComputeForcedSuccessors(coords, parentMove) };
+        }
+        successorTables_.push_back(successorTable);
+    }
+    return patternIter->second;
+}
+
+template <int L>
+Connections<L> Grid2D<L>::ComputeCanonicalSuccessors(Offset2D coords, const Move<L>& parentMove) const
 {
     Connections<L> successors{};
     const Connections<L> neighbors = gridGraph_[coords];
@@ -259,7 +498,7 @@ Connections<L> Grid2D<L>::CanonicalSuccessors(Offset2D coords, const Move<L>& pa
 }
 
 template <int L>
-Connections<L> Grid2D<L>::ForcedSuccessors(Offset2D coords, const Move<L>& parentMove) const
+Connections<L> Grid2D<L>::ComputeForcedSuccessors(Offset2D coords, const Move<L>& parentMove) const
 {
     Connections<L> successors{};
     const Connections<L> neighbors = gridGraph_[coords];
@@ -13,6 +13,10 @@
 #include <memory>
 #include <algorithm>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace central64 {
 
 /// An unsigned integer traits class for compact representation of grid connections. Used by the `Connections` class.
@@ -23,6 +27,19 @@ template <> struct Unsigned<16> { using type = uint16_t; static constexpr type z
 template <> struct Unsigned<32> { using type = uint32_t; static constexpr type zero = 0; static constexpr type unit = 1; static constexpr type max =         0xFFFFFFFF; };  ///< The specialization of `Unsigned` for 32-bit unsigned integers.
 template <> struct Unsigned<64> { using type = uint64_t; static constexpr type zero = 0; static constexpr type unit = 1; static constexpr type max = 0xFFFFFFFFFFFFFFFF; };  ///< The specialization of `Unsigned` for 64-bit unsigned integers.
 
+/// Obtain the index of the lowest set bit in `bits`, which must be nonzero.
+inline int CountTrailingZeros(uint64_t bits)
+{
+    assert(bits != 0);
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return int(index);
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
 } // namespace
 
 #endif
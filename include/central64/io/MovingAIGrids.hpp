@@ -4,6 +4,9 @@
 
 #include <central64/grid/Offset2D.hpp>
 #include <fstream>
+#include <cstdlib>
+#include <optional>
+#include <string_view>
 
 namespace central64 {
 
@@ -26,22 +29,49 @@ private:
     std::ifstream mapFile_{};
 };
 
+/// A path planning scenario read from one line of a Moving AI Lab grid map scenario file.
+struct MovingAIGridScenario
+{
+    int bucket{ 0 };              ///< The bucket index, which groups scenarios with similar optimal path lengths.
+    std::string mapName{};        ///< The name of the map file to which the scenario applies.
+    Offset2D mapDims{};           ///< The dimensions of the map, in cells.
+    Offset2D sourceCoords{};      ///< The coordinates of the start point.
+    Offset2D sampleCoords{};      ///< The coordinates of the goal point.
+    double optimalLength{ 0.0 };  ///< The optimal 8-neighbor path length reported in the file.
+};
+
 /// A file access object that reads path planning scenarios from a Moving AI Lab grid map scenario file.
+/// Scenarios may be read all at once using `Read`, or streamed incrementally using `ReadScenario`
+/// or `ReadScenarios` so that very large files need not be held in memory.
 /// File format information and sample files can be found here: https://movingai.com/benchmarks/grids.html
 class MovingAIGridScenarioFile
 {
 public:
     MovingAIGridScenarioFile() = default;  ///< Create a grid map scenario file access object.
 
-    void Open(const std::string& filename) { scenFile_.open(filename); }  ///< Open the file with name `filename`.
-    void Close() { scenFile_.close(); }                                   ///< Close the file.
-    bool IsOpen() const { return scenFile_.is_open(); }                   ///< Check if the file is open.
+    void Open(const std::string& filename) { scenFile_.open(filename); versionRead_ = false; }  ///< Open the file with name `filename`.
+    void Close() { scenFile_.close(); }                                                         ///< Close the file.
+    bool IsOpen() const { return scenFile_.is_open(); }                                         ///< Check if the file is open.
 
-    /// Read the scenarios as a vector of pairs of end point coordinates.
+    /// Read all remaining scenarios as a vector of pairs of end point coordinates.
     std::vector<std::pair<Offset2D, Offset2D>> Read();
 
+    /// Read the next scenario, including its bucket and optimal length.
+    /// If there are no more scenarios, return an empty optional.
+    std::optional<MovingAIGridScenario> ReadScenario();
+
+    /// Read up to `maxCount` of the next scenarios, which is useful for processing a file in batches.
+    /// If fewer than `maxCount` scenarios are returned, the end of the file has been reached.
+    std::vector<MovingAIGridScenario> ReadScenarios(int maxCount);
+
 private:
+    // Parse a scenario from a single `line` of the file.
+    // If the line does not contain a complete scenario, return an empty optional.
+    static std::optional<MovingAIGridScenario> ParseScenario(const std::string& line);
+
     std::ifstream scenFile_{};
+    std::string line_{};
+    bool versionRead_{ false };
 };
 
 inline std::vector<std::vector<bool>> MovingAIGridMapFile::Read()
@@ -75,29 +105,86 @@ inline std::vector<std::vector<bool>> MovingAIGridMapFile::Read()
 inline std::vector<std::pair<Offset2D, Offset2D>> MovingAIGridScenarioFile::Read()
 {
     std::vector<std::pair<Offset2D, Offset2D>> scenarios{};
+    std::optional<MovingAIGridScenario> scenario = ReadScenario();
+    while (scenario) {
+        scenarios.push_back({ scenario->sourceCoords, scenario->sampleCoords });
+        scenario = ReadScenario();
+    }
+    return scenarios;
+}
+
+inline std::optional<MovingAIGridScenario> MovingAIGridScenarioFile::ReadScenario()
+{
+    std::optional<MovingAIGridScenario> scenario{};
     if (IsOpen()) {
-        std::string line;
-        std::string token;
-        std::getline(scenFile_, line);
-        while (scenFile_ >> token) {
-            scenFile_ >> token;
-            scenFile_ >> token;
-            scenFile_ >> token;
-            scenFile_ >> token;
-            int xA = std::stoi(token);
-            scenFile_ >> token;
-            int yA = std::stoi(token);
-            scenFile_ >> token;
-            int xB = std::stoi(token);
-            scenFile_ >> token;
-            int yB = std::stoi(token);
-            scenFile_ >> token;
-            scenarios.push_back({ {xA, yA}, {xB, yB} });
+        // Skip the version line at the beginning of the file.
+        if (!versionRead_) {
+            std::getline(scenFile_, line_);
+            versionRead_ = true;
+        }
+
+        // Parse one line at a time, skipping any lines that do not contain a scenario.
+        while (!scenario && std::getline(scenFile_, line_)) {
+            scenario = ParseScenario(line_);
         }
     }
+    return scenario;
+}
+
+inline std::vector<MovingAIGridScenario> MovingAIGridScenarioFile::ReadScenarios(int maxCount)
+{
+    std::vector<MovingAIGridScenario> scenarios{};
+    scenarios.reserve(std::max(0, maxCount));
+    while (int(scenarios.size()) < maxCount) {
+        std::optional<MovingAIGridScenario> scenario = ReadScenario();
+        if (!scenario) {
+            break;
+        }
+        scenarios.push_back(std::move(*scenario));
+    }
     return scenarios;
 }
 
+inline std::optional<MovingAIGridScenario> MovingAIGridScenarioFile::ParseScenario(const std::string& line)
+{
+    // Split the line into whitespace-delimited fields without copying them.
+    constexpr int fieldCount = 9;
+    std::array<std::string_view, fieldCount> fields{};
+    const std::string_view lineView{ line };
+    size_t position = 0;
+    int fieldIndex = 0;
+    while (fieldIndex < fieldCount) {
+        const size_t first = lineView.find_first_not_of(" \t\r", position);
+        if (first == std::string_view::npos) {
+            break;
+        }
+        position = std::min(lineView.find_first_of(" \t\r", first), lineView.size());
+        fields[fieldIndex++] = lineView.substr(first, position - first);
+    }
+
+    // Convert the fields, rejecting the line if any integer field is malformed.
+    std::optional<MovingAIGridScenario> scenario{};
+    if (fieldIndex == fieldCount) {
+        std::array<int, 7> values{};
+        const std::array<int, 7> valueFields = { 0, 2, 3, 4, 5, 6, 7 };
+        bool valid = true;
+        for (int i = 0; valid && i < int(valueFields.size()); ++i) {
+            const std::string_view field = fields[valueFields[i]];
+            valid = (std::from_chars(field.data(), field.data() + field.size(), values[i]).ec == std::errc{});
+        }
+        if (valid) {
+            scenario = MovingAIGridScenario{};
+            scenario->bucket = values[0];
+            scenario->mapName = std::string{ fields[1] };
+            scenario->mapDims = { values[1], values[2] };
+            scenario->sourceCoords = { values[3], values[4] };
+            scenario->sampleCoords = { values[5], values[6] };
+            scenario->optimalLength = std::strtod(std::string{ fields[8] }.c_str(), nullptr);
+        }
+    }
+    return scenario;
+}
+
 }  // namespace
 
 #endif
@@ -51,7 +51,8 @@ bool AStarSearch<L>::ProcessSearchNode(Offset2D coords, PathCost fCost)
     // A central grid path search must process all nodes with a cost less
     // than or equal to that of the sample. A regular grid path search
     // must process all nodes with a cost strictly less than the sample.
-    const bool searching = IsAllNodesSearch() ? true :
+    // An all-nodes search terminates once the cost cap has been exceeded.
+    const bool searching = IsAllNodesSearch() ? (fCost <= Tree().CostCap()) :
                                                 Centralize() ? (fCost <= Tree().GCost(SampleCoords())) :
                                                                (fCost < Tree().GCost(SampleCoords()));
 
@@ -4,6 +4,7 @@
 
 #include <central64/search/PathTree.hpp>
 #include <central64/search/PathFlow.hpp>
+#include <central64/search/StageTimes.hpp>
 
 namespace central64 {
 
@@ -23,10 +24,26 @@ public:
                                        bool centralize = true,
                                        bool fromSource = true);
 
+    /// Compute a shortest path from any of the source coordinates `sourceCoords` to the nearest of the sample coordinates `sampleCoords`,
+    /// using a single search. Afterward, `SourceCoords` and `SampleCoords` give the pair of vertices connected by the path.
+    /// If `centralize` is true, then compute a central grid path between the chosen pair; otherwise compute a regular grid path.
+    /// A central grid path is obtained by searching again between the chosen pair, so it costs a second point-to-point search.
+    /// If `fromSource` is true, then arrange the path from source to sample; otherwise from sample to source.
+    /// If no path is found, return an empty vector.
+    std::vector<Offset2D> PlanGridPath(const std::vector<Offset2D>& sourceCoords,
+                                       const std::vector<Offset2D>& sampleCoords,
+                                       bool centralize = true,
+                                       bool fromSource = true);
+
     /// Conduct an all-nodes search from source coordinates `sourceCoords` to all reachable nodes in the grid.
     /// Paths originating or terminating at the source can then be efficiently sampled using `SampleGridPath`.
     void SearchAllNodes(Offset2D sourceCoords);
 
+    /// Conduct an all-nodes search from source coordinates `sourceCoords` that stops expanding nodes beyond the cost cap `maxCost`.
+    /// Paths between the source and any vertex within `maxCost` of it can then be efficiently sampled using `SampleGridPath`.
+    /// Sampling a vertex that lies beyond the cost cap yields an empty vector.
+    void SearchWithinCost(Offset2D sourceCoords, PathCost maxCost);
+
     /// Sample a path between sample coordinates `sampleCoords` and the previously supplied source.
     /// If `centralize` is true, then compute a central grid path; otherwise compute a regular grid path.
     /// If `fromSource` is true, then arrange the path from source to sample; otherwise from sample to source.
@@ -37,6 +54,12 @@ public:
 
     const Grid2D<L>& Grid() const { return grid_; }  ///< Obtain a const reference to the grid.
 
+    /// Replace a region of input cells in the grid, as described for `Grid2D::UpdateCells`, and return the coordinates
+    /// of every vertex whose set of connections has changed. A new search is required before sampling further paths.
+    std::vector<Offset2D> UpdateCells(Offset2D cellCoords, const std::vector<std::vector<bool>>& regionCells);
+
+    void PrecomputeSuccessors() { grid_.PrecomputeSuccessors(); }  ///< Precompute the canonical and forced successors of every vertex in the grid, as described for `Grid2D::PrecomputeSuccessors`.
+
     bool IsAllNodesSearch() const { return Tree().IsAllNodesSearch(); }  ///< Check if the current search is an all-nodes (e.g. Dijkstra) search.
 
     Offset2D SourceCoords() const { return Tree().SourceCoords(); }  ///< Get the coordinates of the current source vertex, the root of the shortest grid path tree.
@@ -48,6 +71,12 @@ public:
     PathTree<L>& Tree() const { return *pathTreePtr_; }  ///< Obtain a reference to the path tree object.
     PathFlow<L>& Flow() const { return *pathFlowPtr_; }  ///< Obtain a reference to the path flow object.
 
+    const StageTimes& Times() const { return stageTimes_; }  ///< Get the cumulative time spent in each search and extraction stage, if stage timing is enabled.
+    void ResetTimes() { stageTimes_ = StageTimes{}; }        ///< Reset the cumulative stage times to zero.
+
+    const SearchStatistics& Statistics() const { return Tree().Statistics(); }  ///< Get the cumulative search statistics, if statistics counting is enabled.
+    void ResetStatistics() { Tree().Statistics() = SearchStatistics{}; }        ///< Reset the cumulative search statistics to zero.
+
     virtual std::string MethodName() const = 0;          ///< Get the name of the search method.
     virtual std::string AllNodesMethodName() const = 0;  ///< Get the name of the all-nodes version of the search method.
 
@@ -59,6 +88,22 @@ protected:
 
     virtual void PerformSearch() = 0;  ///< Perform the current path search, populating the shortest grid path tree.
 
+    /// Begin a new search with the specified source coordinates (`sourceCoords`) and sample coordinates (`sampleCoords`).
+    /// By default the path tree is reset, but an incremental search method may retain the results of the previous search.
+    virtual void InitializeSearch(Offset2D sourceCoords, Offset2D sampleCoords) { Tree().InitializeSearch(sourceCoords, sampleCoords); }
+
+    /// Begin a new all-nodes search with the specified source coordinates (`sourceCoords`) and cost cap (`costCap`).
+    /// By default the path tree is reset, but an incremental search method may retain the results of the previous search.
+    virtual void InitializeAllNodesSearch(Offset2D sourceCoords, PathCost costCap) { Tree().InitializeAllNodesSearch(sourceCoords, costCap); }
+
+    /// Begin a new search from every source in `sourceCoords` to the nearest sample in `sampleCoords`.
+    /// By default the path tree is reset, and an incremental search method must also reset its own state.
+    virtual void InitializeMultiSearch(const std::vector<Offset2D>& sourceCoords, const std::vector<Offset2D>& sampleCoords) { Tree().InitializeMultiSearch(sourceCoords, sampleCoords); }
+
+    /// Respond to a change in the connections of the vertices at `changedVertices`, following a grid update.
+    /// By default nothing is done, since every search begins by resetting the path tree.
+    virtual void UpdateVertices(const std::vector<Offset2D>& changedVertices) {}
+
     bool IsSearchNodeInitialized(Offset2D coords) const { return Tree().IsSearchNodeInitialized(coords); }  ///< Check whether the node at coordinates `coords` has been initialized for the current search.
 
     void InitializeDijkstraNode(Offset2D coords) { Tree().InitializeDijkstraNode(coords); }    ///< Initialize the node at coordinates `coords` for the current search, without computing the heuristic.
@@ -79,6 +124,7 @@ private:
     std::unique_ptr<PathFlow<L>> pathFlowPtr_;
     bool centralize_;
     bool fromSource_;
+    StageTimes stageTimes_;
 };
 
 template <int L>
@@ -90,16 +136,21 @@ std::vector<Offset2D> AbstractSearch<L>::PlanGridPath(Offset2D sourceCoords,
     std::vector<Offset2D> pathVertices{};
     centralize_ = centralize;
     fromSource_ = fromSource;
-    Tree().InitializeSearch(sourceCoords, sampleCoords);
+    InitializeSearch(sourceCoords, sampleCoords);
     if (Grid().Contains(SourceCoords()) && Grid().Contains(SampleCoords())) {
         // Perform the path search as specified in the derived class.
-        PerformSearch();
+        {
+            StageTimer timer{ stageTimes_.search };
+            PerformSearch();
+        }
 
         // Extract either a central grid path using the path flow object, or a regular grid path using the path tree object.
         if (Centralize()) {
+            StageTimer timer{ stageTimes_.centralExtraction };
             pathVertices = Flow().ExtractCentralPath();
         }
         else {
+            StageTimer timer{ stageTimes_.regularExtraction };
             pathVertices = Tree().ExtractRegularPath();
         }
 
@@ -111,12 +162,58 @@ std::vector<Offset2D> AbstractSearch<L>::PlanGridPath(Offset2D sourceCoords,
     return pathVertices;
 }
 
+template <int L>
+std::vector<Offset2D> AbstractSearch<L>::PlanGridPath(const std::vector<Offset2D>& sourceCoords,
+                                                      const std::vector<Offset2D>& sampleCoords,
+                                                      bool centralize,
+                                                      bool fromSource)
+{
+    std::vector<Offset2D> pathVertices{};
+    centralize_ = centralize;
+    fromSource_ = fromSource;
+    if (!sourceCoords.empty() && !sampleCoords.empty()) {
+        // Perform a single search from all sources that terminates at the nearest sample.
+        InitializeMultiSearch(sourceCoords, sampleCoords);
+        {
+            StageTimer timer{ stageTimes_.search };
+            PerformSearch();
+        }
+
+        // Extract a regular grid path, which identifies the source and sample that it connects.
+        // The nearest sample is selected once more, in case the queue emptied after a sample was last improved.
+        Tree().UpdateNearestSample();
+        {
+            StageTimer timer{ stageTimes_.regularExtraction };
+            pathVertices = Tree().ExtractRegularPath();
+        }
+
+        // The path flow object counts paths between one source and one sample, whereas the g-costs of the
+        // multi search are distances to the nearest source, and may lead to other sources at the same distance.
+        // So to obtain a central grid path, search again between the chosen pair, which costs a second search.
+        // Otherwise reverse the path if needed so that it starts at the source.
+        if (Centralize() && !pathVertices.empty()) {
+            pathVertices = PlanGridPath(pathVertices.back(), pathVertices.front(), true, fromSource);
+        }
+        else if (FromSource()) {
+            std::reverse(std::begin(pathVertices), std::end(pathVertices));
+        }
+    }
+    return pathVertices;
+}
+
 template <int L>
 void AbstractSearch<L>::SearchAllNodes(Offset2D sourceCoords)
 {
-    Tree().InitializeAllNodesSearch(sourceCoords);
+    SearchWithinCost(sourceCoords, PathCost::MaxCost());
+}
+
+template <int L>
+void AbstractSearch<L>::SearchWithinCost(Offset2D sourceCoords, PathCost maxCost)
+{
+    InitializeAllNodesSearch(sourceCoords, maxCost);
     if (Grid().Contains(SourceCoords())) {
         // Perform the path search as specified in the derived class.
+        StageTimer timer{ stageTimes_.search };
         PerformSearch();
     }
 }
@@ -133,9 +230,11 @@ std::vector<Offset2D> AbstractSearch<L>::SampleGridPath(Offset2D sampleCoords,
     if (Grid().Contains(SourceCoords()) && Grid().Contains(SampleCoords())) {
         // Extract either a central grid path using the path flow object, or a regular grid path using the path tree object.
         if (Centralize()) {
+            StageTimer timer{ stageTimes_.centralExtraction };
             pathVertices = Flow().ExtractCentralPath();
         }
         else {
+            StageTimer timer{ stageTimes_.regularExtraction };
             pathVertices = Tree().ExtractRegularPath();
         }
 
@@ -147,6 +246,14 @@ std::vector<Offset2D> AbstractSearch<L>::SampleGridPath(Offset2D sampleCoords,
     return pathVertices;
 }
 
+template <int L>
+std::vector<Offset2D> AbstractSearch<L>::UpdateCells(Offset2D cellCoords, const std::vector<std::vector<bool>>& regionCells)
+{
+    std::vector<Offset2D> changedVertices = grid_.UpdateCells(cellCoords, regionCells);
+    UpdateVertices(changedVertices);
+    return changedVertices;
+}
+
 template <int L>
 AbstractSearch<L>::AbstractSearch(const Grid2D<L>& grid)
     : grid_{ grid }
@@ -154,6 +261,7 @@ AbstractSearch<L>::AbstractSearch(const Grid2D<L>& grid)
     , pathFlowPtr_{}
     , centralize_{ true }
     , fromSource_{ true }
+    , stageTimes_{}
 {
     pathTreePtr_ = std::make_unique<PathTree<L>>(grid_);
     pathFlowPtr_ = std::make_unique<PathFlow<L>>(grid_, *pathTreePtr_);
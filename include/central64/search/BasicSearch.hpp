@@ -3,6 +3,7 @@
 #define CENTRAL64_BASIC_SEARCH
 
 #include <central64/search/AbstractSearch.hpp>
+#include <central64/search/Relaxation.hpp>
 
 namespace central64 {
 
@@ -56,21 +57,32 @@ BasicSearch<L>::BasicSearch(const Grid2D<L>& grid)
 template <int L>
 void BasicSearch<L>::PerformSearch()
 {
-    // Initialize the source node.
-    InitializeHeuristicNode(SourceCoords());
+    // Initialize the source nodes.
+    for (const Offset2D& sourceCoords : Tree().Sources()) {
+        if (!IsSearchNodeInitialized(sourceCoords)) {
+            InitializeHeuristicNode(sourceCoords);
+        }
+    }
 
-    // If the current search is not an all-nodes search, and if the sample
-    // coordinates are different than the source, initialize the sample node.
+    // If the current search is not an all-nodes search, initialize
+    // the sample nodes that are not also source nodes.
     if (!IsAllNodesSearch()) {
-        if (SampleCoords() != SourceCoords()) {
-            InitializeHeuristicNode(SampleCoords());
+        for (const Offset2D& sampleCoords : Tree().Samples()) {
+            if (!IsSearchNodeInitialized(sampleCoords)) {
+                InitializeHeuristicNode(sampleCoords);
+            }
         }
     }
 
-    // Create a new queue to ensure it is empty, and expand the source node.
+    // Create a new queue to ensure it is empty, and expand the source nodes.
+    // All of the source g-costs are set before any source is expanded.
     queue_ = CreateHeuristicQueue();
-    Tree().SetGCost(SourceCoords(), PathCost(0));
-    ExpandSearchNode(SourceCoords(), Grid().Neighbors(SourceCoords()));
+    for (const Offset2D& sourceCoords : Tree().Sources()) {
+        Tree().SetGCost(sourceCoords, PathCost(0));
+    }
+    for (const Offset2D& sourceCoords : Tree().Sources()) {
+        ExpandSearchNode(sourceCoords, Grid().Neighbors(sourceCoords));
+    }
 
     // Repeatedly process one of the nodes with the lowest f-cost, until 
     // the queue is empty or the termination conditions have been satisfied.
@@ -81,6 +93,7 @@ void BasicSearch<L>::PerformSearch()
         if (searching) {
             const Offset2D coords = node->first;
             const PathCost fCost = node->second;
+            Tree().UpdateNearestSample();
             searching = ProcessSearchNode(coords, fCost);
         }
     }
@@ -89,25 +102,30 @@ void BasicSearch<L>::PerformSearch()
 template <int L>
 void BasicSearch<L>::ExpandSearchNode(Offset2D coords, Connections<L> successors)
 {
-    const PathCost gCost = Tree().GCost(coords);
-    for (const Move<L>& move : Neighborhood<L>::Moves()) {
-        if (successors.IsConnected(move)) {
-            // Obtain the coordinates of the current successor, and ensure the node is initialized.
-            const Offset2D successorCoords = coords + move.Offset();
-            if (!IsSearchNodeInitialized(successorCoords)) {
-                InitializeHeuristicNode(successorCoords);
-            }
-
-            // Obtain the g-cost of a path to the successor via the node being expanded.
-            // If this is now the shortest path to the successor, update the successor
-            // node in the path tree and push it onto the queue.
-            const PathCost successorGCost = gCost + move.Cost();
-            if (successorGCost < Tree().GCost(successorCoords)) {
-                Tree().SetGCost(successorCoords, successorGCost);
-                Tree().SetParentMove(successorCoords, -move);
-                queue_.Push(successorCoords);
-            }
+    CountStatistic(Tree().Statistics().expansions);
+    const int index = Grid().Index(coords);
+    const PathCost gCost = Tree().GCost(index);
+
+    // Ensure each successor node is initialized, and gather the successor g-costs.
+    // Moves that are not connected keep a g-cost of zero, so they are never relaxed.
+    // Nodes are addressed by linear index, avoiding the conversion of coordinates on every access.
+    std::array<PathCost, L> successorGCosts{};
+    for (const Move<L>& move : successors) {
+        const int successorIndex = Grid().NeighborIndex(coords, index, move);
+        if (!Tree().IsSearchNodeInitialized(successorIndex)) {
+            Tree().InitializeHeuristicNode(coords + move.Offset(), successorIndex);
         }
+        successorGCosts[move.Index()] = Tree().GCost(successorIndex);
+    }
+
+    // Relax all successors at once. For each successor that now has a shorter path
+    // via the node being expanded, update the node in the path tree and push it onto the queue.
+    const uint64_t improvedMoves = Relaxation<L>::ImprovedMoves(gCost, successorGCosts);
+    for (const Move<L>& move : Connections<L>{ typename Unsigned<L>::type(improvedMoves) }) {
+        const int successorIndex = Grid().NeighborIndex(coords, index, move);
+        Tree().SetGCost(successorIndex, gCost + move.Cost());
+        Tree().SetParentMove(successorIndex, -move);
+        queue_.Push(coords + move.Offset(), successorIndex);
     }
 }
 
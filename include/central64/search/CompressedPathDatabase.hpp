@@ -0,0 +1,230 @@
+#pragma once
+#ifndef CENTRAL64_COMPRESSED_PATH_DATABASE
+#define CENTRAL64_COMPRESSED_PATH_DATABASE
+
+#include <central64/search/AStarSearch.hpp>
+#include <atomic>
+#include <thread>
+
+namespace central64 {
+
+/// A compressed path database for the `L`-neighbor grid, which records the first move of a shortest grid path from
+/// every vertex toward every target vertex. The first moves toward each target are obtained from an all-nodes search
+/// from the target, and stored as a row of runs of consecutive vertices that share a first move. Since a vertex often
+/// has several first moves that begin shortest grid paths, each run is extended for as long as some first move is
+/// shared by all of its vertices. Vertices are listed in the order of a depth-first traversal of the grid, so that
+/// nearby vertices, which tend to share first moves, tend to form long runs. Vertices that cannot reach the target
+/// never have their first moves looked up, so they are absorbed into the adjacent runs. In a central database, only
+/// the moves to the neighbors with the most shortest grid paths to the target are considered, which are the moves
+/// that the path flow may select first when extracting a central grid path from the vertex.
+template <int L>
+class CompressedPathDatabase
+{
+public:
+    CompressedPathDatabase() = default;  ///< Create an empty database with no vertices.
+
+    /// Build the database for `grid`, computing central first moves if `central` is true. The all-nodes searches from
+    /// the targets are distributed across `threadCount` threads, each of which has its own search object and path tree.
+    explicit CompressedPathDatabase(const Grid2D<L>& grid, bool central = true, int threadCount = 1);
+
+    Offset2D Dims() const { return dims_; }                        ///< Get the dimensions of the grid for which the database was built.
+    bool IsCentral() const { return central_; }                    ///< Check whether the first moves were selected from central grid paths.
+    int VertexCount() const { return int(vertexCoords_.size()); }  ///< Get the number of vertices.
+    int64_t RunCount() const { return int64_t(runs_.size()); }     ///< Get the total number of runs of first moves, which determines the size of the database.
+
+    bool IsReachable(Offset2D targetCoords, Offset2D coords) const;  ///< Check whether a grid path connects the vertex at `coords` to the vertex at `targetCoords`.
+
+    /// Get the first move of a shortest grid path from the vertex at `coords` to the vertex at `targetCoords`.
+    /// The vertices must be distinct, and must be connected by a grid path.
+    Move<L> FirstMove(Offset2D targetCoords, Offset2D coords) const;
+
+private:
+    // Each run is packed into a single integer, with the index of its first vertex in the upper bits
+    // and the index of the first move shared by its vertices in the lower bits.
+    static constexpr int moveBits = 6;
+    static constexpr uint32_t moveMask = (uint32_t(1) << moveBits) - 1;
+
+    // List the vertices in depth-first order, and label the connected components of the grid.
+    void OrderVertices(const Grid2D<L>& grid);
+
+    // Compute the `row` of runs for the vertex `target`, using the all-nodes `search` and the working arrays `moveSets`, `order`, and `counts`.
+    void CompressRow(AStarSearch<L>& search, int target, std::vector<uint64_t>& moveSets, std::vector<int>& order, std::vector<PathCount>& counts, std::vector<uint32_t>& row) const;
+
+    Offset2D dims_{ 0, 0 };
+    bool central_{ false };
+    Array2D<int> vertices_{};               // The index of the vertex at each pair of coordinates.
+    std::vector<Offset2D> vertexCoords_{};  // The coordinates of each vertex, in depth-first order.
+    std::vector<int> components_{};         // The connected component of each vertex.
+    std::vector<int64_t> rowOffsets_{};     // The position of the first run of each target's row, followed by the total number of runs.
+    std::vector<uint32_t> runs_{};          // The packed runs of all rows.
+};
+
+template <int L>
+CompressedPathDatabase<L>::CompressedPathDatabase(const Grid2D<L>& grid, bool central, int threadCount)
+    : dims_{ grid.Dims() }
+    , central_{ central }
+{
+    OrderVertices(grid);
+    assert(VertexCount() <= int(uint32_t(1) << (32 - moveBits)));  // Each vertex index should fit within the upper bits of a run.
+
+    // Threads claim the targets one at a time, until none remain. The calling thread also computes rows.
+    std::vector<std::vector<uint32_t>> rows(VertexCount());
+    std::atomic<int> nextTarget{ 0 };
+    const auto computeRows = [&]() {
+        AStarSearch<L> search{ grid };
+        std::vector<uint64_t> moveSets{};
+        std::vector<int> order{};
+        std::vector<PathCount> counts{};
+        for (int target = nextTarget++; target < VertexCount(); target = nextTarget++) {
+            CompressRow(search, target, moveSets, order, counts, rows[target]);
+        }
+    };
+    std::vector<std::thread> workers{};
+    for (int i = 1; i < threadCount; ++i) {
+        workers.emplace_back(computeRows);
+    }
+    computeRows();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // Concatenate the rows.
+    rowOffsets_.assign(1, 0);
+    for (std::vector<uint32_t>& row : rows) {
+        runs_.insert(std::end(runs_), std::begin(row), std::end(row));
+        rowOffsets_.push_back(int64_t(runs_.size()));
+        row = {};
+    }
+}
+
+template <int L>
+inline bool CompressedPathDatabase<L>::IsReachable(Offset2D targetCoords, Offset2D coords) const
+{
+    return components_[vertices_[targetCoords]] == components_[vertices_[coords]];
+}
+
+template <int L>
+inline Move<L> CompressedPathDatabase<L>::FirstMove(Offset2D targetCoords, Offset2D coords) const
+{
+    assert(targetCoords != coords);
+    assert(IsReachable(targetCoords, coords));
+
+    // Find the last run of the target's row that begins at or before the vertex.
+    const int target = vertices_[targetCoords];
+    const uint32_t key = (uint32_t(vertices_[coords]) << moveBits) | moveMask;
+    const auto rowBegin = std::begin(runs_) + rowOffsets_[target];
+    const auto rowEnd = std::begin(runs_) + rowOffsets_[target + 1];
+    const auto run = std::upper_bound(rowBegin, rowEnd, key) - 1;
+    assert(run >= rowBegin);
+    return Neighborhood<L>::Moves()[*run & moveMask];
+}
+
+template <int L>
+void CompressedPathDatabase<L>::OrderVertices(const Grid2D<L>& grid)
+{
+    // Traverse each connected component depth-first from its first vertex in row-major order, listing each vertex
+    // as it is taken from the stack. Vertices that are connected and close together then tend to be listed together.
+    vertices_ = Array2D<int>{ dims_, -1 };
+    vertexCoords_.clear();
+    components_.clear();
+    Array2D<bool> visited{ dims_, false };
+    std::vector<Offset2D> traversalStack{};
+    int componentCount = 0;
+    for (int y = 0; y < dims_.Y(); ++y) {
+        for (int x = 0; x < dims_.X(); ++x) {
+            if (!visited[{ x, y }]) {
+                visited[{ x, y }] = true;
+                traversalStack.assign(1, { x, y });
+                while (!traversalStack.empty()) {
+                    const Offset2D coords = traversalStack.back();
+                    traversalStack.pop_back();
+                    vertices_[coords] = VertexCount();
+                    vertexCoords_.push_back(coords);
+                    components_.push_back(componentCount);
+                    for (const Move<L>& move : grid.Neighbors(coords)) {
+                        const Offset2D neighborCoords = coords + move.Offset();
+                        if (!visited[neighborCoords]) {
+                            visited[neighborCoords] = true;
+                            traversalStack.push_back(neighborCoords);
+                        }
+                    }
+                }
+                ++componentCount;
+            }
+        }
+    }
+}
+
+template <int L>
+void CompressedPathDatabase<L>::CompressRow(AStarSearch<L>& search, int target, std::vector<uint64_t>& moveSets, std::vector<int>& order, std::vector<PathCount>& counts, std::vector<uint32_t>& row) const
+{
+    // Search from the target, then find the moves from each reachable vertex to a neighbor on a shortest grid path to the target.
+    const PathTree<L>& tree = search.Tree();
+    search.SearchAllNodes(vertexCoords_[target]);
+    moveSets.assign(VertexCount(), 0);
+    order.clear();
+    for (int vertex = 0; vertex < VertexCount(); ++vertex) {
+        if (vertex != target && tree.GCost(vertexCoords_[vertex]) != PathCost::MaxCost()) {
+            order.push_back(vertex);
+        }
+    }
+    if (central_) {
+        // Count the shortest grid paths from each vertex to the target, in order of increasing g-cost, as a path flow would.
+        // Only the moves to the neighbors with the most shortest grid paths to the target are retained.
+        std::sort(std::begin(order), std::end(order), [&](int lhs, int rhs) {
+            return tree.GCost(vertexCoords_[lhs]) < tree.GCost(vertexCoords_[rhs]);
+        });
+        counts.assign(VertexCount(), PathCount{});
+        counts[target] = PathCount::UnitCount();
+    }
+    for (int vertex : order) {
+        const Offset2D coords = vertexCoords_[vertex];
+        const PathCost gCost = tree.GCost(coords);
+        PathCount highestCount{};
+        for (const Move<L>& move : search.Grid().Neighbors(coords)) {
+            if (tree.GCost(coords + move.Offset()) == gCost - move.Cost()) {
+                const uint64_t moveSet = uint64_t(1) << move.Index();
+                if (central_) {
+                    const int neighbor = vertices_[coords + move.Offset()];
+                    counts[vertex] += counts[neighbor];
+                    if (counts[neighbor] > highestCount) {
+                        highestCount = counts[neighbor];
+                        moveSets[vertex] = moveSet;
+                    }
+                    else if (counts[neighbor] == highestCount) {
+                        moveSets[vertex] |= moveSet;
+                    }
+                }
+                else {
+                    moveSets[vertex] |= moveSet;
+                }
+            }
+        }
+    }
+
+    // Extend each run for as long as its vertices share at least one first move, and start a new run otherwise.
+    // Vertices without first moves are skipped. The first run begins at the first vertex, so that every vertex
+    // with first moves lies within a run.
+    row.clear();
+    int runStart = 0;
+    uint64_t runMoveSet = ~uint64_t(0);
+    for (int vertex = 0; vertex < VertexCount(); ++vertex) {
+        if (moveSets[vertex] != 0) {
+            if ((runMoveSet & moveSets[vertex]) == 0) {
+                row.push_back((uint32_t(runStart) << moveBits) | uint32_t(CountTrailingZeros(runMoveSet)));
+                runStart = vertex;
+                runMoveSet = moveSets[vertex];
+            }
+            else {
+                runMoveSet &= moveSets[vertex];
+            }
+        }
+    }
+    if (runMoveSet != ~uint64_t(0)) {
+        row.push_back((uint32_t(runStart) << moveBits) | uint32_t(CountTrailingZeros(runMoveSet)));
+    }
+}
+
+}  // namespace
+
+#endif
@@ -0,0 +1,154 @@
+#pragma once
+#ifndef CENTRAL64_COMPRESSED_PATH_DATABASE_SEARCH
+#define CENTRAL64_COMPRESSED_PATH_DATABASE_SEARCH
+
+#include <central64/search/BasicSearch.hpp>
+#include <central64/search/CompressedPathDatabase.hpp>
+
+namespace central64 {
+
+/// A derived class for the `L`-neighbor compressed path database search method, which is intended for repeated queries
+/// on static maps where memory can be traded for speed. Each query follows the first moves toward the source recorded
+/// in the database, beginning at the sample, and assigns the resulting shortest grid path to the path tree. If the
+/// database is central, each move is the one the path flow would select first when extracting a central grid path from
+/// the current vertex, so the path closely resembles a central grid path, and the path flow reproduces it unchanged.
+/// Since rebuilding the database requires an all-nodes search from every vertex, an update of the grid only marks the
+/// database as outdated, and it is rebuilt once by the next point-to-point search, however many updates came before it.
+/// All-nodes and multi searches do not use the database, and are performed as Dijkstra and A* searches.
+template <int L>
+class CompressedPathDatabaseSearch : public BasicSearch<L>
+{
+public:
+    /// Create a compressed path database search object that references an existing grid object, and build the database,
+    /// selecting central first moves if `central` is true, and distributing the work across `threadCount` threads.
+    explicit CompressedPathDatabaseSearch(const Grid2D<L>& grid, bool central = true, int threadCount = 1);
+
+    CompressedPathDatabaseSearch(CompressedPathDatabaseSearch&&) = default;             ///< Ensure the default move constructor is public.
+    CompressedPathDatabaseSearch& operator=(CompressedPathDatabaseSearch&&) = default;  ///< Ensure the default move assignment operator is public.
+
+    std::string MethodName() const { return "Compressed Path Database Search"; }  ///< Get the name of the search method.
+    std::string AllNodesMethodName() const { return "Dijkstra Search"; }          ///< Get the name of the all-nodes version of the search method, which does not use the database.
+
+    const CompressedPathDatabase<L>& Database() const { return database_; }  ///< Get the compressed path database, which is outdated if the grid has been updated since the last point-to-point search.
+
+    const Grid2D<L>& Grid() const { return BasicSearch<L>::Grid(); }
+    bool IsAllNodesSearch() const { return BasicSearch<L>::IsAllNodesSearch(); }
+    Offset2D SourceCoords() const { return BasicSearch<L>::SourceCoords(); }
+    Offset2D SampleCoords() const { return BasicSearch<L>::SampleCoords(); }
+    bool Centralize() const { return BasicSearch<L>::Centralize(); }
+    bool FromSource() const { return BasicSearch<L>::FromSource(); }
+    PathTree<L>& Tree() const { return BasicSearch<L>::Tree(); }
+    PathFlow<L>& Flow() const { return BasicSearch<L>::Flow(); }
+
+private:
+    // Follow the database if the current search is a point-to-point search. Otherwise perform a basic search.
+    void PerformSearch();
+
+    // Process the node at coordinates `coords` of an all-nodes or multi search, given its f-cost `fCost`.
+    bool ProcessSearchNode(Offset2D coords, PathCost fCost);
+
+    // Mark the database as outdated, since the connections of the vertices at `changedVertices` have changed.
+    void UpdateVertices(const std::vector<Offset2D>& changedVertices);
+
+    // Follow the first moves from the sample to the source, and assign the g-costs and parent moves along the way.
+    void FollowFirstMoves();
+
+    bool IsSearchNodeInitialized(Offset2D coords) const { return BasicSearch<L>::IsSearchNodeInitialized(coords); }
+    void InitializeHeuristicNode(Offset2D coords) { BasicSearch<L>::InitializeHeuristicNode(coords); }
+
+    void ExpandSearchNode(Offset2D coords, Connections<L> successors) { BasicSearch<L>::ExpandSearchNode(coords, successors); }
+
+    int threadCount_;                   // The number of threads across which the database is built.
+    CompressedPathDatabase<L> database_;
+    bool databaseOutdated_;             // Whether the grid has been updated since the database was built.
+    std::vector<Move<L>> pathMoves_;    // The moves of the path found, from sample to source.
+};
+
+template <int L>
+CompressedPathDatabaseSearch<L>::CompressedPathDatabaseSearch(const Grid2D<L>& grid, bool central, int threadCount)
+    : BasicSearch<L>{ grid }
+    , threadCount_{ std::max(1, threadCount) }
+    , database_{ grid, central, threadCount_ }
+    , databaseOutdated_{ false }
+    , pathMoves_{}
+{
+}
+
+template <int L>
+void CompressedPathDatabaseSearch<L>::PerformSearch()
+{
+    if (IsAllNodesSearch() || Tree().IsMultiSearch()) {
+        BasicSearch<L>::PerformSearch();
+    }
+    else {
+        // Initialize the source and sample nodes of the path tree.
+        InitializeHeuristicNode(SourceCoords());
+        Tree().SetGCost(SourceCoords(), PathCost(0));
+        if (!IsSearchNodeInitialized(SampleCoords())) {
+            InitializeHeuristicNode(SampleCoords());
+        }
+
+        // Rebuild the database if the grid has been updated, then follow it only if the sample can be reached.
+        if (databaseOutdated_) {
+            database_ = CompressedPathDatabase<L>{ Grid(), database_.IsCentral(), threadCount_ };
+            databaseOutdated_ = false;
+        }
+        if (SampleCoords() != SourceCoords() && database_.IsReachable(SourceCoords(), SampleCoords())) {
+            FollowFirstMoves();
+        }
+    }
+}
+
+template <int L>
+bool CompressedPathDatabaseSearch<L>::ProcessSearchNode(Offset2D coords, PathCost fCost)
+{
+    // Terminate the search under the same conditions as an A* or Dijkstra search.
+    const bool searching = IsAllNodesSearch() ? (fCost <= Tree().CostCap()) :
+                                                Centralize() ? (fCost <= Tree().GCost(SampleCoords())) :
+                                                               (fCost < Tree().GCost(SampleCoords()));
+
+    // If the search is to continue, expand the current node.
+    if (searching) {
+        ExpandSearchNode(coords, Grid().Neighbors(coords));
+    }
+    return searching;
+}
+
+template <int L>
+void CompressedPathDatabaseSearch<L>::UpdateVertices(const std::vector<Offset2D>& changedVertices)
+{
+    databaseOutdated_ = true;
+}
+
+template <int L>
+void CompressedPathDatabaseSearch<L>::FollowFirstMoves()
+{
+    // The source is the target of every lookup, so each first move is a parent move of the path tree.
+    pathMoves_.clear();
+    PathCost pathCost(0);
+    Offset2D coords = SampleCoords();
+    while (coords != SourceCoords()) {
+        CountStatistic(Tree().Statistics().expansions);
+        const Move<L> move = database_.FirstMove(SourceCoords(), coords);
+        pathMoves_.push_back(move);
+        pathCost += move.Cost();
+        coords += move.Offset();
+    }
+
+    // Assign the g-costs, which decrease from the cost of the whole path at the sample to zero at the source.
+    coords = SampleCoords();
+    for (const Move<L>& move : pathMoves_) {
+        if (!IsSearchNodeInitialized(coords)) {
+            InitializeHeuristicNode(coords);
+        }
+        Tree().SetGCost(coords, pathCost);
+        Tree().SetParentMove(coords, move);
+        pathCost -= move.Cost();
+        coords += move.Offset();
+    }
+    assert(pathCost == PathCost(0));
+}
+
+}  // namespace
+
+#endif
@@ -0,0 +1,414 @@
+#pragma once
+#ifndef CENTRAL64_CONTRACTION_HIERARCHY
+#define CENTRAL64_CONTRACTION_HIERARCHY
+
+#include <central64/grid/Grid2D.hpp>
+#include <istream>
+#include <ostream>
+#include <queue>
+
+namespace central64 {
+
+/// A contraction hierarchy of the graph of connections of an `L`-neighbor grid, intended for static maps.
+/// The vertices are contracted one at a time in order of increasing rank. Whenever the contraction of a vertex would
+/// lengthen the shortest path between two of its remaining neighbors, a shortcut is added between them. Each edge
+/// is stored with the endpoint of lower rank, and each shortcut records the contracted vertex that it bypasses,
+/// so that a path through the hierarchy can be unpacked into a grid path. Vertices are identified by their ranks
+/// in decreasing order, so vertex 0 is the last to be contracted. The vertices of highest rank, which most
+/// queries reach, are therefore stored together in memory.
+template <int L>
+class ContractionHierarchy
+{
+public:
+    /// An edge between two vertices, stored with the endpoint of lower rank.
+    struct Edge {
+        int vertex;     ///< The endpoint of higher rank.
+        int middle;     ///< The vertex bypassed by a shortcut, or -1 if the edge is a grid move.
+        PathCost cost;  ///< The cost of the edge.
+    };
+
+    ContractionHierarchy() = default;                       ///< Create an empty contraction hierarchy.
+    explicit ContractionHierarchy(const Grid2D<L>& grid);  ///< Build the contraction hierarchy of the connections of `grid`.
+
+    Offset2D Dims() const { return dims_; }                         ///< Get the number of grid vertices in each dimension.
+    int VertexCount() const { return int(vertexCoords_.size()); }  ///< Get the number of vertices.
+    int EdgeCount() const { return int(edges_.size()); }           ///< Get the number of edges, including shortcuts.
+
+    int Vertex(Offset2D coords) const { return vertices_[coords.Y()*dims_.X() + coords.X()]; }  ///< Get the vertex at coordinates `coords`.
+    Offset2D VertexCoords(int vertex) const { return vertexCoords_[vertex]; }                   ///< Get the coordinates of `vertex`.
+
+    int EdgesBegin(int vertex) const { return edgeOffsets_[vertex]; }    ///< Get the index of the first edge stored with `vertex`.
+    int EdgesEnd(int vertex) const { return edgeOffsets_[vertex + 1]; }  ///< Get the index that follows the last edge stored with `vertex`.
+    const Edge& GetEdge(int edgeIndex) const { return edges_[edgeIndex]; }  ///< Get the edge at index `edgeIndex`.
+
+    /// Find the edge between the vertices `vertexA` and `vertexB`, which must exist.
+    const Edge& FindEdge(int vertexA, int vertexB) const;
+
+    /// Write the hierarchy to the binary `stream`, along with a checksum of the connections from which it was built.
+    /// Integers and costs are written in the byte order of the current platform.
+    void Write(std::ostream& stream) const;
+
+    /// Replace the hierarchy with one read from the binary `stream`, which must have been written for a grid with the
+    /// same neighborhood size, dimensions, and connections as `grid`. If it was not, or the stream cannot be read,
+    /// return false and leave the hierarchy unchanged.
+    bool Read(std::istream& stream, const Grid2D<L>& grid);
+
+    static constexpr int witnessSettleLimit = 256;  ///< The maximum number of vertices settled by a witness search, beyond which a shortcut is added.
+
+private:
+    // A shortcut that must be added between two neighbors of a vertex before the vertex is contracted.
+    struct Shortcut {
+        int vertexA;
+        int vertexB;
+        PathCost cost;
+    };
+
+    struct QueueNode {
+        int vertex;
+        PathCost cost;
+    };
+
+    struct LowerPriority {
+        bool operator()(const QueueNode& lhs, const QueueNode& rhs) const { return lhs.cost > rhs.cost; }
+    };
+
+    // The working state of the contraction process, which is discarded once the hierarchy is built.
+    struct Contraction {
+        std::vector<std::vector<Edge>> remainingEdges;  // The edges between each uncontracted vertex and its uncontracted neighbors.
+        std::vector<int> contractedNeighborCounts;      // The number of contracted neighbors of each vertex.
+        std::vector<uint64_t> witnessIDs;               // The ID of the witness search in which each vertex was last reached.
+        std::vector<PathCost> witnessCosts;             // The cost of the shortest witness path found to each vertex.
+        uint64_t currentWitnessID;
+        std::priority_queue<QueueNode, std::vector<QueueNode>, LowerPriority> witnessQueue;
+    };
+
+    // Contract every vertex of `grid`, recording the ranks and edges of the hierarchy.
+    void Build(const Grid2D<L>& grid);
+
+    // Find the shortcuts that the contraction of `vertex` requires, and return its contraction priority.
+    // Vertices with lower priorities are contracted first.
+    static int FindShortcuts(Contraction& contraction, int vertex, std::vector<Shortcut>& shortcuts);
+
+    // Search for the shortest paths from `sourceVertex` that avoid `avoidedVertex`, stopping beyond `maxCost`.
+    static void SearchWitnesses(Contraction& contraction, int sourceVertex, int avoidedVertex, PathCost maxCost);
+
+    // Add the `edge` to `edges`, unless `edges` already has an edge to the same vertex that is no more costly.
+    static void AddEdge(std::vector<Edge>& edges, const Edge& edge);
+
+    // Compute a checksum of the neighborhood size, dimensions, and connections of `grid`.
+    static uint64_t Checksum(const Grid2D<L>& grid);
+
+    static constexpr uint32_t fileTag = 0x48343643;  // The tag "C64H" that begins a hierarchy file.
+    static constexpr uint32_t fileVersion = 1;       // The version of the hierarchy file format.
+
+    Offset2D dims_{};
+    std::vector<int> vertices_{};           // The vertex at each grid location, in row-major order.
+    std::vector<Offset2D> vertexCoords_{};  // The coordinates of each vertex.
+    std::vector<int> edgeOffsets_{};        // The index of the first edge of each vertex, followed by the total number of edges.
+    std::vector<Edge> edges_{};             // The edges of every vertex to neighbors of higher rank, grouped by vertex.
+    uint64_t checksum_{ 0 };                // The checksum of the grid from which the hierarchy was built.
+};
+
+template <int L>
+ContractionHierarchy<L>::ContractionHierarchy(const Grid2D<L>& grid)
+{
+    Build(grid);
+}
+
+template <int L>
+const typename ContractionHierarchy<L>::Edge& ContractionHierarchy<L>::FindEdge(int vertexA, int vertexB) const
+{
+    const int lowerVertex = std::max(vertexA, vertexB);
+    const int higherVertex = std::min(vertexA, vertexB);
+    int edgeIndex = EdgesBegin(lowerVertex);
+    while (edges_[edgeIndex].vertex != higherVertex) {
+        ++edgeIndex;
+        assert(edgeIndex < EdgesEnd(lowerVertex));
+    }
+    return edges_[edgeIndex];
+}
+
+template <int L>
+void ContractionHierarchy<L>::Build(const Grid2D<L>& grid)
+{
+    // Gather the connections of each grid location, identified during contraction by its row-major index.
+    dims_ = grid.Dims();
+    checksum_ = Checksum(grid);
+    const int vertexCount = dims_.X()*dims_.Y();
+    Contraction contraction{};
+    contraction.remainingEdges.resize(vertexCount);
+    contraction.contractedNeighborCounts.assign(vertexCount, 0);
+    contraction.witnessIDs.assign(vertexCount, 0);
+    contraction.witnessCosts.assign(vertexCount, PathCost::MaxCost());
+    contraction.currentWitnessID = 0;
+    for (int y = 0; y < dims_.Y(); ++y) {
+        for (int x = 0; x < dims_.X(); ++x) {
+            for (const Move<L>& move : grid.Neighbors({ x, y })) {
+                const Offset2D neighborCoords = Offset2D{ x, y } + move.Offset();
+                contraction.remainingEdges[y*dims_.X() + x].push_back({ neighborCoords.Y()*dims_.X() + neighborCoords.X(), -1, move.Cost() });
+            }
+        }
+    }
+
+    // Order the vertices by their initial priorities, breaking ties by row-major index.
+    std::vector<Shortcut> shortcuts{};
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> contractionQueue{};
+    for (int index = 0; index < vertexCount; ++index) {
+        contractionQueue.push({ FindShortcuts(contraction, index, shortcuts), index });
+    }
+
+    // Repeatedly contract the vertex of lowest priority. Priorities are only updated when a vertex reaches the front
+    // of the queue. If its priority has risen above that of the next vertex, it is returned to the queue instead.
+    // Vertices are numbered in the reverse of the order in which they are contracted.
+    std::vector<std::vector<Edge>> upwardEdges(vertexCount);
+    vertices_.assign(vertexCount, -1);
+    vertexCoords_.assign(vertexCount, Offset2D{});
+    int vertex = vertexCount;
+    while (!contractionQueue.empty()) {
+        const int index = contractionQueue.top().second;
+        contractionQueue.pop();
+        const int priority = FindShortcuts(contraction, index, shortcuts);
+        if (!contractionQueue.empty() && priority > contractionQueue.top().first) {
+            contractionQueue.push({ priority, index });
+        }
+        else {
+            // Keep the remaining edges of the vertex as its edges in the hierarchy, and remove them from its neighbors.
+            vertices_[index] = --vertex;
+            vertexCoords_[vertex] = { index % dims_.X(), index/dims_.X() };
+            upwardEdges[vertex].swap(contraction.remainingEdges[index]);
+            for (const Edge& edge : upwardEdges[vertex]) {
+                std::vector<Edge>& neighborEdges = contraction.remainingEdges[edge.vertex];
+                neighborEdges.erase(std::find_if(std::begin(neighborEdges), std::end(neighborEdges),
+                                                 [index](const Edge& neighborEdge) { return neighborEdge.vertex == index; }));
+                ++contraction.contractedNeighborCounts[edge.vertex];
+            }
+            for (const Shortcut& shortcut : shortcuts) {
+                AddEdge(contraction.remainingEdges[shortcut.vertexA], { shortcut.vertexB, index, shortcut.cost });
+                AddEdge(contraction.remainingEdges[shortcut.vertexB], { shortcut.vertexA, index, shortcut.cost });
+            }
+        }
+    }
+
+    // Store the edges of all vertices in a single array, replacing row-major indices with vertices.
+    edgeOffsets_.assign(1, 0);
+    edges_.clear();
+    for (vertex = 0; vertex < vertexCount; ++vertex) {
+        for (const Edge& edge : upwardEdges[vertex]) {
+            edges_.push_back({ vertices_[edge.vertex], (edge.middle < 0) ? -1 : vertices_[edge.middle], edge.cost });
+        }
+        edgeOffsets_.push_back(int(edges_.size()));
+    }
+}
+
+template <int L>
+int ContractionHierarchy<L>::FindShortcuts(Contraction& contraction, int vertex, std::vector<Shortcut>& shortcuts)
+{
+    // A shortcut is needed between two neighbors of the vertex unless a witness path that avoids
+    // the vertex is no more costly than the path through it.
+    shortcuts.clear();
+    const std::vector<Edge>& edges = contraction.remainingEdges[vertex];
+    for (int i = 0; i + 1 < int(edges.size()); ++i) {
+        PathCost maxCost{};
+        for (int j = i + 1; j < int(edges.size()); ++j) {
+            maxCost = std::max(maxCost, edges[i].cost + edges[j].cost);
+        }
+        SearchWitnesses(contraction, edges[i].vertex, vertex, maxCost);
+        for (int j = i + 1; j < int(edges.size()); ++j) {
+            const PathCost cost = edges[i].cost + edges[j].cost;
+            const bool witnessed = (contraction.witnessIDs[edges[j].vertex] == contraction.currentWitnessID) &&
+                                   (contraction.witnessCosts[edges[j].vertex] <= cost);
+            if (!witnessed) {
+                shortcuts.push_back({ edges[i].vertex, edges[j].vertex, cost });
+            }
+        }
+    }
+
+    // Prefer vertices whose contraction removes more edges than it adds, and spread the
+    // contractions across the grid by penalizing vertices with contracted neighbors.
+    return 2*(int(shortcuts.size()) - int(edges.size())) + contraction.contractedNeighborCounts[vertex];
+}
+
+template <int L>
+void ContractionHierarchy<L>::SearchWitnesses(Contraction& contraction, int sourceVertex, int avoidedVertex, PathCost maxCost)
+{
+    const uint64_t witnessID = ++contraction.currentWitnessID;
+    contraction.witnessIDs[sourceVertex] = witnessID;
+    contraction.witnessCosts[sourceVertex] = PathCost(0);
+    while (!contraction.witnessQueue.empty()) {
+        contraction.witnessQueue.pop();  // Empty the queue left by the previous search, keeping its storage.
+    }
+    contraction.witnessQueue.push({ sourceVertex, PathCost(0) });
+    int settledCount = 0;
+    bool searching = true;
+    while (searching) {
+        searching = !contraction.witnessQueue.empty() &&
+                    (contraction.witnessQueue.top().cost <= maxCost) &&
+                    (settledCount < witnessSettleLimit);
+        if (searching) {
+            const QueueNode node = contraction.witnessQueue.top();
+            contraction.witnessQueue.pop();
+            if (node.cost == contraction.witnessCosts[node.vertex]) {
+                ++settledCount;
+                for (const Edge& edge : contraction.remainingEdges[node.vertex]) {
+                    if (edge.vertex != avoidedVertex) {
+                        const PathCost cost = node.cost + edge.cost;
+                        if (contraction.witnessIDs[edge.vertex] != witnessID || cost < contraction.witnessCosts[edge.vertex]) {
+                            contraction.witnessIDs[edge.vertex] = witnessID;
+                            contraction.witnessCosts[edge.vertex] = cost;
+                            contraction.witnessQueue.push({ edge.vertex, cost });
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <int L>
+void ContractionHierarchy<L>::AddEdge(std::vector<Edge>& edges, const Edge& edge)
+{
+    auto existingEdge = std::find_if(std::begin(edges), std::end(edges),
+                                     [&edge](const Edge& otherEdge) { return otherEdge.vertex == edge.vertex; });
+    if (existingEdge == std::end(edges)) {
+        edges.push_back(edge);
+    }
+    else if (edge.cost < existingEdge->cost) {
+        *existingEdge = edge;
+    }
+}
+
+template <int L>
+uint64_t ContractionHierarchy<L>::Checksum(const Grid2D<L>& grid)
+{
+    // Combine the values using the 64-bit FNV-1a hash function.
+    uint64_t checksum = 0xcbf29ce484222325;
+    auto combine = [&checksum](uint64_t value) { checksum = (checksum ^ value)*0x100000001b3; };
+    combine(uint64_t(L));
+    combine(uint64_t(grid.Dims().X()));
+    combine(uint64_t(grid.Dims().Y()));
+    for (int y = 0; y < grid.Dims().Y(); ++y) {
+        for (int x = 0; x < grid.Dims().X(); ++x) {
+            combine(uint64_t(grid.Neighbors({ x, y }).Flags()));
+        }
+    }
+    return checksum;
+}
+
+template <int L>
+void ContractionHierarchy<L>::Write(std::ostream& stream) const
+{
+    auto write = [&stream](const auto& value) { stream.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+    write(fileTag);
+    write(fileVersion);
+    write(int32_t(L));
+    write(int32_t(dims_.X()));
+    write(int32_t(dims_.Y()));
+    write(checksum_);
+    write(int32_t(edges_.size()));
+    for (int vertex : vertices_) {
+        write(int32_t(vertex));
+    }
+    for (int edgeOffset : edgeOffsets_) {
+        write(int32_t(edgeOffset));
+    }
+    for (const Edge& edge : edges_) {
+        write(int32_t(edge.vertex));
+        write(int32_t(edge.middle));
+        write(edge.cost.Distance());
+    }
+}
+
+template <int L>
+bool ContractionHierarchy<L>::Read(std::istream& stream, const Grid2D<L>& grid)
+{
+    auto read = [&stream](auto& value) { stream.read(reinterpret_cast<char*>(&value), sizeof(value)); return bool(stream); };
+
+    // Check that the header matches the grid.
+    uint32_t tag = 0;
+    uint32_t version = 0;
+    int32_t neighborhoodSize = 0;
+    int32_t nx = 0;
+    int32_t ny = 0;
+    uint64_t checksum = 0;
+    int32_t edgeCount = 0;
+    bool valid = read(tag) && read(version) && read(neighborhoodSize) && read(nx) && read(ny) && read(checksum) && read(edgeCount) &&
+                 (tag == fileTag) && (version == fileVersion) && (neighborhoodSize == L) &&
+                 (Offset2D{ nx, ny } == grid.Dims()) && (checksum == Checksum(grid)) && (edgeCount >= 0);
+
+    // Read the vertices and edges, checking that every grid location has a distinct vertex, and every index is in range.
+    const int vertexCount = nx*ny;
+    const Offset2D unassignedCoords{ -1, -1 };
+    ContractionHierarchy<L> hierarchy{};
+    if (valid) {
+        hierarchy.dims_ = grid.Dims();
+        hierarchy.checksum_ = checksum;
+        hierarchy.vertices_.resize(vertexCount);
+        hierarchy.vertexCoords_.assign(vertexCount, unassignedCoords);
+        hierarchy.edgeOffsets_.resize(vertexCount + 1);
+
+        // The edge count has not been checked against the data that follows, so a corrupt header must not
+        // determine the allocation. Reserve no more than a typical hierarchy needs, and append edges as read.
+        hierarchy.edges_.reserve(size_t(std::min(int64_t(edgeCount), int64_t(L)*vertexCount)));
+    }
+    for (int i = 0; valid && i < vertexCount; ++i) {
+        int32_t vertex = 0;
+        valid = read(vertex) && (vertex >= 0) && (vertex < vertexCount) && (hierarchy.vertexCoords_[vertex] == unassignedCoords);
+        if (valid) {
+            hierarchy.vertices_[i] = vertex;
+            hierarchy.vertexCoords_[vertex] = { i % nx, i/nx };
+        }
+    }
+    for (int i = 0; valid && i <= vertexCount; ++i) {
+        int32_t edgeOffset = 0;
+        valid = read(edgeOffset) && (edgeOffset >= ((i == 0) ? 0 : hierarchy.edgeOffsets_[i - 1])) && (edgeOffset <= edgeCount);
+        hierarchy.edgeOffsets_[i] = edgeOffset;
+    }
+    valid = valid && (hierarchy.edgeOffsets_[vertexCount] == edgeCount);
+    for (int i = 0; valid && i < edgeCount; ++i) {
+        int32_t vertex = 0;
+        int32_t middle = 0;
+        double distance = 0.0;
+        valid = read(vertex) && read(middle) && read(distance) &&
+                (vertex >= 0) && (vertex < vertexCount) && (middle >= -1) && (middle < vertexCount) && (distance > 0.0);
+        hierarchy.edges_.push_back({ vertex, middle, PathCost(distance) });
+    }
+
+    // Check that every edge leads to a vertex of higher rank, which has a lower index, so that queries only search upward.
+    // A grid move must be a connection of the grid with the cost of the move. A shortcut must bypass a vertex of lower
+    // rank than both endpoints, and be replaceable by the edges from that vertex to each endpoint, so that unpacking it
+    // always finds those edges and ends with grid moves.
+    auto findEdge = [&hierarchy](int lowerVertex, int higherVertex) {
+        const auto edgesBegin = std::begin(hierarchy.edges_) + hierarchy.edgeOffsets_[lowerVertex];
+        const auto edgesEnd = std::begin(hierarchy.edges_) + hierarchy.edgeOffsets_[lowerVertex + 1];
+        const auto edge = std::find_if(edgesBegin, edgesEnd, [higherVertex](const Edge& edge) { return edge.vertex == higherVertex; });
+        return (edge == edgesEnd) ? nullptr : &*edge;
+    };
+    for (int lowerVertex = 0; valid && lowerVertex < vertexCount; ++lowerVertex) {
+        for (int i = hierarchy.EdgesBegin(lowerVertex); valid && i < hierarchy.EdgesEnd(lowerVertex); ++i) {
+            const Edge& edge = hierarchy.edges_[i];
+            valid = (edge.vertex < lowerVertex);
+            if (valid && edge.middle < 0) {
+                const Offset2D coords = hierarchy.VertexCoords(lowerVertex);
+                const Offset2D higherCoords = hierarchy.VertexCoords(edge.vertex);
+                bool connected = false;
+                for (const Move<L>& move : grid.Neighbors(coords)) {
+                    connected = connected || (coords + move.Offset() == higherCoords && move.Cost() == edge.cost);
+                }
+                valid = connected;
+            }
+            else if (valid) {
+                const Edge* lowerHalf = (edge.middle > lowerVertex) ? findEdge(edge.middle, lowerVertex) : nullptr;
+                const Edge* higherHalf = (edge.middle > lowerVertex) ? findEdge(edge.middle, edge.vertex) : nullptr;
+                valid = lowerHalf && higherHalf && (lowerHalf->cost + higherHalf->cost == edge.cost);
+            }
+        }
+    }
+    if (valid) {
+        *this = std::move(hierarchy);
+    }
+    return valid;
+}
+
+}  // namespace
+
+#endif
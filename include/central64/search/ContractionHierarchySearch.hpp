@@ -0,0 +1,369 @@
+#pragma once
+#ifndef CENTRAL64_CONTRACTION_HIERARCHY_SEARCH
+#define CENTRAL64_CONTRACTION_HIERARCHY_SEARCH
+
+#include <central64/search/BasicSearch.hpp>
+#include <central64/search/ContractionHierarchy.hpp>
+#include <central64/search/TautPathRefinement.hpp>
+
+namespace central64 {
+
+/// A derived class for the `L`-neighbor contraction hierarchy search method, which is intended for repeated queries on static maps.
+/// Each query performs a bidirectional search of the hierarchy, in which both the forward search from the source and
+/// the backward search from the sample only follow edges to vertices of higher rank. Vertices reached more cheaply
+/// from a vertex of higher rank are stalled rather than expanded. The shortcuts of the path found are unpacked into
+/// a shortest grid path, which is assigned to the path tree when a regular grid path is requested. When a central
+/// grid path is requested, the grid path is divided into taut paths, and each taut path is refined by assigning
+/// g-costs to the vertices of all taut paths between its endpoints, so that the path flow can be computed as usual.
+/// Central grid paths are therefore central among the shortest grid paths through the endpoints of the taut paths.
+/// Since rebuilding the hierarchy contracts every vertex again, an update of the grid only marks the hierarchy as
+/// outdated, and it is rebuilt once by the next point-to-point search, however many updates came before it.
+/// All-nodes and multi searches do not use the hierarchy, and are performed as Dijkstra and A* searches.
+template <int L>
+class ContractionHierarchySearch : public BasicSearch<L>
+{
+public:
+    explicit ContractionHierarchySearch(const Grid2D<L>& grid);  ///< Create a contraction hierarchy search object that references an existing grid object, and build the hierarchy.
+
+    /// Create a contraction hierarchy search object that references an existing grid object, and uses a `hierarchy`
+    /// previously built for a grid with the same dimensions and connections.
+    ContractionHierarchySearch(const Grid2D<L>& grid, ContractionHierarchy<L> hierarchy);
+
+    ContractionHierarchySearch(ContractionHierarchySearch&&) = default;             ///< Ensure the default move constructor is public.
+    ContractionHierarchySearch& operator=(ContractionHierarchySearch&&) = default;  ///< Ensure the default move assignment operator is public.
+
+    std::string MethodName() const { return "Contraction Hierarchy Search"; }  ///< Get the name of the search method.
+    std::string AllNodesMethodName() const { return "Dijkstra Search"; }       ///< Get the name of the all-nodes version of the search method, which does not use the hierarchy.
+
+    const ContractionHierarchy<L>& Hierarchy() const { return hierarchy_; }  ///< Get the contraction hierarchy, which may be written to a stream and read back for the same map, and is outdated if the grid has been updated since the last point-to-point search.
+    void UpdateHierarchy();                                                  ///< Rebuild the hierarchy now if the grid has been updated since it was built, rather than in the next point-to-point search.
+
+    const Grid2D<L>& Grid() const { return BasicSearch<L>::Grid(); }
+    bool IsAllNodesSearch() const { return BasicSearch<L>::IsAllNodesSearch(); }
+    Offset2D SourceCoords() const { return BasicSearch<L>::SourceCoords(); }
+    Offset2D SampleCoords() const { return BasicSearch<L>::SampleCoords(); }
+    bool Centralize() const { return BasicSearch<L>::Centralize(); }
+    bool FromSource() const { return BasicSearch<L>::FromSource(); }
+    PathTree<L>& Tree() const { return BasicSearch<L>::Tree(); }
+    PathFlow<L>& Flow() const { return BasicSearch<L>::Flow(); }
+
+private:
+    using Edge = typename ContractionHierarchy<L>::Edge;
+
+    // The attributes of a vertex during a query, in the forward and backward directions.
+    struct HierarchyNode {
+        uint64_t queryID{ 0 };                       // The ID of the query for which the node was last initialized.
+        std::array<PathCost, 2> gCosts{};            // The cost of the shortest upward path found from the source and from the sample.
+        std::array<int, 2> parentVertices{ -1, -1 };  // The preceding vertex on each shortest upward path found.
+    };
+
+    struct QueueNode {
+        int vertex;
+        PathCost gCost;
+    };
+
+    struct LowerPriority {
+        bool operator()(const QueueNode& lhs, const QueueNode& rhs) const { return lhs.gCost > rhs.gCost; }
+    };
+
+    using HierarchyQueue = std::priority_queue<QueueNode, std::vector<QueueNode>, LowerPriority>;
+
+    static constexpr int forward = 0;   // The direction of the search from the source.
+    static constexpr int backward = 1;  // The direction of the search from the sample.
+
+    // Search the hierarchy if the current search is a point-to-point search. Otherwise perform a basic search.
+    void PerformSearch();
+
+    // Process the node at coordinates `coords` of an all-nodes or multi search, given its f-cost `fCost`.
+    bool ProcessSearchNode(Offset2D coords, PathCost fCost);
+
+    // Mark the hierarchy as outdated, since the connections of the vertices at `changedVertices` have changed.
+    void UpdateVertices(const std::vector<Offset2D>& changedVertices);
+
+    // Search the hierarchy from both the source and the sample, and return the vertex of highest rank on
+    // the shortest path found. If the sample cannot be reached, return -1.
+    int SearchHierarchy();
+
+    // Expand the `vertex` in the search direction `direction`, unless it is stalled.
+    void ExpandHierarchyNode(int direction, int vertex);
+
+    // Initialize the node of `vertex` in both directions, if it has not already been initialized for the current query.
+    void InitializeHierarchyNode(int vertex);
+
+    // Unpack the path through the hierarchy that meets at `meetingVertex` into a shortest grid path. For a central
+    // grid path, refine each of the taut paths that make up the grid path. Otherwise assign the grid path itself.
+    void RefinePath(int meetingVertex);
+
+    // Append the vertices after `vertexA` on the grid path represented by the edge from `vertexA` to `vertexB`.
+    void UnpackEdge(int vertexA, int vertexB);
+
+    // Reset the query state after the hierarchy has been built or replaced.
+    void ResetQueries();
+
+    bool IsSearchNodeInitialized(Offset2D coords) const { return BasicSearch<L>::IsSearchNodeInitialized(coords); }
+    void InitializeHeuristicNode(Offset2D coords) { BasicSearch<L>::InitializeHeuristicNode(coords); }
+
+    void ExpandSearchNode(Offset2D coords, Connections<L> successors) { BasicSearch<L>::ExpandSearchNode(coords, successors); }
+
+    ContractionHierarchy<L> hierarchy_;
+    bool hierarchyOutdated_;                        // Whether the grid has been updated since the hierarchy was built.
+    std::vector<HierarchyNode> nodes_;              // The query attributes of each vertex.
+    std::array<HierarchyQueue, 2> queues_;          // The priority queues of the forward and backward searches.
+    uint64_t currentQueryID_;
+    std::vector<int> hierarchyPath_;                // The vertices of the path through the hierarchy, from source to sample.
+    std::vector<std::pair<int, int>> unpackStack_;  // The edges yet to be unpacked, with the next edge at the back.
+    std::vector<int> pathVertices_;                 // The vertices of the unpacked grid path, from source to sample.
+    std::vector<PathCost> pathCosts_;               // The cost of the unpacked grid path from the source to each of its vertices.
+    TautPathRefinement<L> refinement_;              // Refines each taut path of the unpacked grid path.
+};
+
+template <int L>
+ContractionHierarchySearch<L>::ContractionHierarchySearch(const Grid2D<L>& grid)
+    : ContractionHierarchySearch{ grid, ContractionHierarchy<L>{ grid } }
+{
+}
+
+template <int L>
+ContractionHierarchySearch<L>::ContractionHierarchySearch(const Grid2D<L>& grid, ContractionHierarchy<L> hierarchy)
+    : BasicSearch<L>{ grid }
+    , hierarchy_{ std::move(hierarchy) }
+    , hierarchyOutdated_{ false }
+    , nodes_{}
+    , queues_{}
+    , currentQueryID_{ 0 }
+    , hierarchyPath_{}
+    , unpackStack_{}
+    , pathVertices_{}
+    , pathCosts_{}
+    , refinement_{}
+{
+    assert(hierarchy_.Dims() == grid.Dims());
+    ResetQueries();
+}
+
+template <int L>
+void ContractionHierarchySearch<L>::PerformSearch()
+{
+    if (IsAllNodesSearch() || Tree().IsMultiSearch()) {
+        BasicSearch<L>::PerformSearch();
+    }
+    else {
+        // Initialize the source and sample nodes of the path tree.
+        InitializeHeuristicNode(SourceCoords());
+        Tree().SetGCost(SourceCoords(), PathCost(0));
+        if (!IsSearchNodeInitialized(SampleCoords())) {
+            InitializeHeuristicNode(SampleCoords());
+        }
+
+        // Rebuild the hierarchy if the grid has been updated, then search it and refine the path found.
+        // Every vertex refined lies on a shortest grid path from source to sample, so its g-cost is exact.
+        UpdateHierarchy();
+        const int meetingVertex = SearchHierarchy();
+        if (meetingVertex >= 0) {
+            RefinePath(meetingVertex);
+        }
+    }
+}
+
+template <int L>
+bool ContractionHierarchySearch<L>::ProcessSearchNode(Offset2D coords, PathCost fCost)
+{
+    // Terminate the search under the same conditions as an A* or Dijkstra search.
+    const bool searching = IsAllNodesSearch() ? (fCost <= Tree().CostCap()) :
+                                                Centralize() ? (fCost <= Tree().GCost(SampleCoords())) :
+                                                               (fCost < Tree().GCost(SampleCoords()));
+
+    // If the search is to continue, expand the current node.
+    if (searching) {
+        ExpandSearchNode(coords, Grid().Neighbors(coords));
+    }
+    return searching;
+}
+
+template <int L>
+void ContractionHierarchySearch<L>::UpdateHierarchy()
+{
+    if (hierarchyOutdated_) {
+        hierarchy_ = ContractionHierarchy<L>{ Grid() };
+        hierarchyOutdated_ = false;
+        ResetQueries();
+    }
+}
+
+template <int L>
+void ContractionHierarchySearch<L>::UpdateVertices(const std::vector<Offset2D>& changedVertices)
+{
+    hierarchyOutdated_ = true;
+}
+
+template <int L>
+int ContractionHierarchySearch<L>::SearchHierarchy()
+{
+    ++currentQueryID_;
+    for (int direction : { forward, backward }) {
+        const int vertex = hierarchy_.Vertex((direction == forward) ? SourceCoords() : SampleCoords());
+        InitializeHierarchyNode(vertex);
+        nodes_[vertex].gCosts[direction] = PathCost(0);
+        while (!queues_[direction].empty()) {
+            queues_[direction].pop();  // Empty the queue left by the previous query, keeping its storage.
+        }
+        CountStatistic(Tree().Statistics().pushes);
+        queues_[direction].push({ vertex, PathCost(0) });
+    }
+
+    // Alternate between the directions by always popping the cheaper of the two queues. Each vertex reached in both
+    // directions joins two upward paths, and the search ends once neither queue can improve the cheapest such join.
+    PathCost bestCost = PathCost::MaxCost();
+    int meetingVertex = -1;
+    bool searching = true;
+    while (searching) {
+        const PathCost forwardCost = queues_[forward].empty() ? PathCost::MaxCost() : queues_[forward].top().gCost;
+        const PathCost backwardCost = queues_[backward].empty() ? PathCost::MaxCost() : queues_[backward].top().gCost;
+        searching = (std::min(forwardCost, backwardCost) < bestCost);
+        if (searching) {
+            const int direction = (forwardCost <= backwardCost) ? forward : backward;
+            const QueueNode node = queues_[direction].top();
+            queues_[direction].pop();
+            if (node.gCost != nodes_[node.vertex].gCosts[direction]) {
+                CountStatistic(Tree().Statistics().stalePops);
+            }
+            else {
+                const PathCost oppositeGCost = nodes_[node.vertex].gCosts[1 - direction];
+                if (node.gCost + oppositeGCost < bestCost) {
+                    bestCost = node.gCost + oppositeGCost;
+                    meetingVertex = node.vertex;
+                }
+                ExpandHierarchyNode(direction, node.vertex);
+            }
+        }
+    }
+    return meetingVertex;
+}
+
+template <int L>
+void ContractionHierarchySearch<L>::ExpandHierarchyNode(int direction, int vertex)
+{
+    // Stall the vertex if a vertex of higher rank already offers a cheaper path to it, since
+    // the vertex then cannot lie on the upward part of a shortest path.
+    const PathCost gCost = nodes_[vertex].gCosts[direction];
+    bool stalled = false;
+    for (int i = hierarchy_.EdgesBegin(vertex); i < hierarchy_.EdgesEnd(vertex); ++i) {
+        const Edge& edge = hierarchy_.GetEdge(i);
+        stalled = stalled || (nodes_[edge.vertex].queryID == currentQueryID_ && nodes_[edge.vertex].gCosts[direction] + edge.cost < gCost);
+    }
+
+    // Otherwise relax every edge to a vertex of higher rank.
+    if (!stalled) {
+        CountStatistic(Tree().Statistics().expansions);
+        for (int i = hierarchy_.EdgesBegin(vertex); i < hierarchy_.EdgesEnd(vertex); ++i) {
+            const Edge& edge = hierarchy_.GetEdge(i);
+            InitializeHierarchyNode(edge.vertex);
+            const PathCost successorGCost = gCost + edge.cost;
+            if (successorGCost < nodes_[edge.vertex].gCosts[direction]) {
+                nodes_[edge.vertex].gCosts[direction] = successorGCost;
+                nodes_[edge.vertex].parentVertices[direction] = vertex;
+                CountStatistic(Tree().Statistics().pushes);
+                queues_[direction].push({ edge.vertex, successorGCost });
+            }
+        }
+    }
+}
+
+template <int L>
+inline void ContractionHierarchySearch<L>::InitializeHierarchyNode(int vertex)
+{
+    HierarchyNode& node = nodes_[vertex];
+    if (node.queryID != currentQueryID_) {
+        node.queryID = currentQueryID_;
+        node.gCosts = { PathCost::MaxCost(), PathCost::MaxCost() };
+        node.parentVertices = { -1, -1 };
+    }
+}
+
+template <int L>
+void ContractionHierarchySearch<L>::RefinePath(int meetingVertex)
+{
+    // Trace the forward parents back to the source, then the backward parents on to the sample.
+    hierarchyPath_.clear();
+    for (int vertex = meetingVertex; vertex >= 0; vertex = nodes_[vertex].parentVertices[forward]) {
+        hierarchyPath_.push_back(vertex);
+    }
+    std::reverse(std::begin(hierarchyPath_), std::end(hierarchyPath_));
+    for (int vertex = nodes_[meetingVertex].parentVertices[backward]; vertex >= 0; vertex = nodes_[vertex].parentVertices[backward]) {
+        hierarchyPath_.push_back(vertex);
+    }
+
+    // Unpack each edge of the path into grid moves.
+    pathVertices_.assign(1, hierarchyPath_[0]);
+    pathCosts_.assign(1, PathCost(0));
+    for (int i = 1; i < int(hierarchyPath_.size()); ++i) {
+        UnpackEdge(hierarchyPath_[i - 1], hierarchyPath_[i]);
+    }
+
+    if (!Centralize()) {
+        // A regular grid path only requires one shortest grid path, so assign the parent moves along the unpacked path.
+        for (int i = 1; i < int(pathVertices_.size()); ++i) {
+            const Offset2D coords = hierarchy_.VertexCoords(pathVertices_[i]);
+            const Offset2D parentCoords = hierarchy_.VertexCoords(pathVertices_[i - 1]);
+            if (!IsSearchNodeInitialized(coords)) {
+                InitializeHeuristicNode(coords);
+            }
+            Tree().SetGCost(coords, pathCosts_[i]);
+            for (const Move<L>& move : Grid().Neighbors(coords)) {
+                if (coords + move.Offset() == parentCoords) {
+                    Tree().SetParentMove(coords, move);
+                }
+            }
+        }
+    }
+    else {
+        // Since any part of a taut path is also taut, the grid path can be divided greedily into taut paths,
+        // each extended for as long as its cost equals the standard cost between its endpoints.
+        int startIndex = 0;
+        for (int i = 1; i < int(pathVertices_.size()); ++i) {
+            const Offset2D startCoords = hierarchy_.VertexCoords(pathVertices_[startIndex]);
+            const Offset2D coords = hierarchy_.VertexCoords(pathVertices_[i]);
+            if (Neighborhood<L>::StandardCost(coords - startCoords) != pathCosts_[i] - pathCosts_[startIndex]) {
+                const Offset2D endCoords = hierarchy_.VertexCoords(pathVertices_[i - 1]);
+                refinement_.RefineTautPath(Grid(), Tree(), startCoords, endCoords, pathCosts_[startIndex]);
+                startIndex = i - 1;
+            }
+        }
+        if (startIndex + 1 < int(pathVertices_.size())) {
+            const Offset2D startCoords = hierarchy_.VertexCoords(pathVertices_[startIndex]);
+            const Offset2D endCoords = hierarchy_.VertexCoords(pathVertices_.back());
+            refinement_.RefineTautPath(Grid(), Tree(), startCoords, endCoords, pathCosts_[startIndex]);
+        }
+    }
+}
+
+template <int L>
+void ContractionHierarchySearch<L>::UnpackEdge(int vertexA, int vertexB)
+{
+    // Replace each shortcut by the two edges that it bypasses, until only grid moves remain.
+    unpackStack_.assign(1, { vertexA, vertexB });
+    while (!unpackStack_.empty()) {
+        const std::pair<int, int> vertices = unpackStack_.back();
+        unpackStack_.pop_back();
+        const Edge& edge = hierarchy_.FindEdge(vertices.first, vertices.second);
+        if (edge.middle < 0) {
+            pathVertices_.push_back(vertices.second);
+            pathCosts_.push_back(pathCosts_.back() + edge.cost);
+        }
+        else {
+            unpackStack_.push_back({ edge.middle, vertices.second });
+            unpackStack_.push_back({ vertices.first, edge.middle });
+        }
+    }
+}
+
+template <int L>
+void ContractionHierarchySearch<L>::ResetQueries()
+{
+    nodes_.assign(hierarchy_.VertexCount(), HierarchyNode{});
+    currentQueryID_ = 0;
+}
+
+}  // namespace
+
+#endif
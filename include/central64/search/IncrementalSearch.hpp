@@ -0,0 +1,345 @@
+#pragma once
+#ifndef CENTRAL64_INCREMENTAL_SEARCH
+#define CENTRAL64_INCREMENTAL_SEARCH
+
+#include <central64/search/AbstractSearch.hpp>
+
+namespace central64 {
+
+/// A derived class for the `L`-neighbor incremental search method, a variant of D* Lite.
+/// The shortest grid path tree is rooted at the source and retained between searches,
+/// along with a one-step lookahead cost (rhs-value) for each node. When the grid is updated
+/// or the sample moves, a subsequent search from the same source repairs only the nodes
+/// whose costs are affected. The g-costs remain exact for all nodes that can lie on a shortest
+/// grid path to the sample, so central grid paths can still be extracted using the path flow object.
+template <int L>
+class IncrementalSearch : public AbstractSearch<L>
+{
+public:
+    explicit IncrementalSearch(const Grid2D<L>& grid);  ///< Create an incremental search object that references an existing grid object.
+
+    IncrementalSearch(IncrementalSearch&&) = default;             ///< Ensure the default move constructor is public.
+    IncrementalSearch& operator=(IncrementalSearch&&) = default;  ///< Ensure the default move assignment operator is public.
+
+    std::string MethodName() const { return "D* Lite Search"; }                       ///< Get the name of the search method.
+    std::string AllNodesMethodName() const { return "Incremental Dijkstra Search"; }  ///< Get the name of the all-nodes version of the search method.
+
+    const Grid2D<L>& Grid() const { return AbstractSearch<L>::Grid(); }
+    bool IsAllNodesSearch() const { return AbstractSearch<L>::IsAllNodesSearch(); }
+    Offset2D SourceCoords() const { return AbstractSearch<L>::SourceCoords(); }
+    Offset2D SampleCoords() const { return AbstractSearch<L>::SampleCoords(); }
+    bool Centralize() const { return AbstractSearch<L>::Centralize(); }
+    bool FromSource() const { return AbstractSearch<L>::FromSource(); }
+    PathTree<L>& Tree() const { return AbstractSearch<L>::Tree(); }
+    PathFlow<L>& Flow() const { return AbstractSearch<L>::Flow(); }
+
+private:
+    // A two-part priority, compared lexicographically.
+    struct Key {
+        PathCost primary{};    // The lesser of the g-cost and rhs-value, plus the heuristic and the key modifier.
+        PathCost secondary{};  // The lesser of the g-cost and rhs-value.
+        bool operator==(const Key& rhs) const { return primary == rhs.primary && secondary == rhs.secondary; }
+        bool operator!=(const Key& rhs) const { return !(*this == rhs); }
+        bool operator<(const Key& rhs) const { return primary < rhs.primary || (primary == rhs.primary && secondary < rhs.secondary); }
+        bool operator>(const Key& rhs) const { return rhs < *this; }
+    };
+
+    // The incremental search attributes of each node, which supplement those in the path tree.
+    struct IncrementalNode {
+        PathCost rhs{};     // The one-step lookahead cost, the lowest g-cost of a predecessor plus the cost of the move.
+        Key key{};          // The key with which the node was most recently pushed, if it is open.
+        bool open{ false };  // Whether the node is locally inconsistent and awaiting processing.
+    };
+
+    struct QueueNode {
+        Offset2D coords;
+        Key key;
+    };
+
+    struct LowerPriority {
+        bool operator()(const QueueNode& lhs, const QueueNode& rhs) const { return lhs.key > rhs.key; }
+    };
+
+    // Begin a point-to-point search, retaining the previous search if it has the same source.
+    void InitializeSearch(Offset2D sourceCoords, Offset2D sampleCoords);
+
+    // Begin an all-nodes search with a cost cap, retaining the previous search if it has the same source.
+    void InitializeAllNodesSearch(Offset2D sourceCoords, PathCost costCap);
+
+    // Begin a multi-source, multi-sample search, which is never retained from or for another search.
+    void InitializeMultiSearch(const std::vector<Offset2D>& sourceCoords, const std::vector<Offset2D>& sampleCoords);
+
+    // Record the vertices whose connections have changed, to be repaired by the next search.
+    void UpdateVertices(const std::vector<Offset2D>& changedVertices);
+
+    // Process inconsistent nodes until the g-cost of every node that can lie on a shortest path to the sample is exact,
+    // or until all reachable nodes within the cost cap are consistent in the case of an all-nodes search.
+    void PerformSearch();
+
+    // Process the open node at coordinates `coords`, making it consistent and updating its neighbors.
+    void ProcessSearchNode(Offset2D coords);
+
+    // Reset the path tree and the queue, and seed the queue with the source nodes.
+    void ResetSearch();
+
+    // Ensure the node at coordinates `coords` is initialized, with an infinite g-cost and rhs-value if it was not.
+    void InitializeIncrementalNode(Offset2D coords);
+
+    // Compute the key of the node at coordinates `coords` from its g-cost and rhs-value.
+    Key CalculateKey(Offset2D coords) const;
+
+    // Recompute the rhs-value and parent move of the node at coordinates `coords` from all of its neighbors.
+    void ComputeRhs(Offset2D coords);
+
+    // Push the node at coordinates `coords` onto the queue if it is inconsistent, or close it if it is consistent.
+    void UpdateQueue(Offset2D coords);
+
+    bool IsSearchNodeInitialized(Offset2D coords) const { return AbstractSearch<L>::IsSearchNodeInitialized(coords); }
+    void InitializeDijkstraNode(Offset2D coords) { AbstractSearch<L>::InitializeDijkstraNode(coords); }
+
+    TiledArray2D<IncrementalNode> nodes_;
+    std::priority_queue<QueueNode, std::vector<QueueNode>, LowerPriority> queue_;
+    std::vector<Offset2D> changedVertices_;  // The vertices with changed connections, awaiting repair.
+    PathCost keyModifier_;                   // The accumulated heuristic distance moved by the sample since the search was reset.
+    Offset2D lastSampleCoords_;              // The sample coordinates of the previous search.
+    bool retained_;                          // Whether the path tree holds a search that may be continued.
+    bool allNodes_;                          // Whether the retained search is an all-nodes search.
+};
+
+template <int L>
+IncrementalSearch<L>::IncrementalSearch(const Grid2D<L>& grid)
+    : AbstractSearch<L>{ grid }
+    , nodes_{ grid.Dims() }
+    , queue_{}
+    , changedVertices_{}
+    , keyModifier_{}
+    , lastSampleCoords_{ PathTree<L>::InvalidCoords() }
+    , retained_{ false }
+    , allNodes_{ false }
+{
+}
+
+template <int L>
+void IncrementalSearch<L>::InitializeSearch(Offset2D sourceCoords, Offset2D sampleCoords)
+{
+    if (retained_ && !allNodes_ && !Tree().IsMultiSearch() && SourceCoords() == sourceCoords) {
+        // Continue the previous search. Because the heuristic is measured from the new sample,
+        // the key modifier is raised by the heuristic distance moved so that earlier keys remain lower bounds.
+        keyModifier_ += Neighborhood<L>::StandardCost(sampleCoords - lastSampleCoords_);
+        Tree().SetSampleCoords(sampleCoords);
+    }
+    else {
+        Tree().InitializeSearch(sourceCoords, sampleCoords);
+        allNodes_ = false;
+        ResetSearch();
+    }
+    lastSampleCoords_ = sampleCoords;
+}
+
+template <int L>
+void IncrementalSearch<L>::InitializeAllNodesSearch(Offset2D sourceCoords, PathCost costCap)
+{
+    if (retained_ && allNodes_ && SourceCoords() == sourceCoords) {
+        // Continue the previous search. Nodes beyond a previous cost cap remain in the queue.
+        Tree().SetCostCap(costCap);
+    }
+    else {
+        Tree().InitializeAllNodesSearch(sourceCoords, costCap);
+        allNodes_ = true;
+        ResetSearch();
+    }
+}
+
+template <int L>
+void IncrementalSearch<L>::InitializeMultiSearch(const std::vector<Offset2D>& sourceCoords, const std::vector<Offset2D>& sampleCoords)
+{
+    Tree().InitializeMultiSearch(sourceCoords, sampleCoords);
+    allNodes_ = false;
+    ResetSearch();
+}
+
+template <int L>
+void IncrementalSearch<L>::UpdateVertices(const std::vector<Offset2D>& changedVertices)
+{
+    if (retained_) {
+        changedVertices_.insert(std::end(changedVertices_), std::begin(changedVertices), std::end(changedVertices));
+    }
+}
+
+template <int L>
+void IncrementalSearch<L>::ResetSearch()
+{
+    queue_ = {};
+    changedVertices_.clear();
+    keyModifier_ = PathCost(0);
+    retained_ = true;
+
+    // The sources are the roots of the tree, and their rhs-values are always zero.
+    for (const Offset2D& sourceCoords : Tree().Sources()) {
+        InitializeIncrementalNode(sourceCoords);
+        nodes_[sourceCoords].rhs = PathCost(0);
+        UpdateQueue(sourceCoords);
+    }
+}
+
+template <int L>
+void IncrementalSearch<L>::PerformSearch()
+{
+    // Repair the rhs-values of the vertices whose connections have changed.
+    // Since connections are symmetric, both ends of every changed connection are included.
+    for (const Offset2D& coords : changedVertices_) {
+        InitializeIncrementalNode(coords);
+        ComputeRhs(coords);
+        UpdateQueue(coords);
+    }
+    changedVertices_.clear();
+
+    // Repeatedly process one of the open nodes with the lowest key, until the queue
+    // is empty or the termination conditions have been satisfied.
+    if (!IsAllNodesSearch()) {
+        for (const Offset2D& sampleCoords : Tree().Samples()) {
+            InitializeIncrementalNode(sampleCoords);
+        }
+    }
+    bool searching = true;
+    while (searching) {
+        searching = !queue_.empty();
+        if (searching) {
+            const QueueNode queueNode = queue_.top();
+            const Offset2D coords = queueNode.coords;
+            IncrementalNode& node = nodes_[coords];
+            if (!node.open || node.key != queueNode.key) {
+                // Discard the entry, since the node has since been closed or pushed with a different key.
+                CountStatistic(Tree().Statistics().stalePops);
+                queue_.pop();
+            }
+            else {
+                // Terminate a point-to-point search once every node with a key less than or equal to that of the
+                // sample has been processed and the sample is consistent. Processing nodes with equal keys ensures
+                // that all nodes on shortest grid paths have exact g-costs, as required for central grid paths.
+                // Terminate an all-nodes search once the primary key exceeds the cost cap.
+                if (!IsAllNodesSearch()) {
+                    Tree().UpdateNearestSample();
+                    const bool sampleConsistent = (Tree().GCost(SampleCoords()) == nodes_[SampleCoords()].rhs);
+                    searching = !(queueNode.key > CalculateKey(SampleCoords()) && sampleConsistent);
+                }
+                else {
+                    searching = (queueNode.key.primary <= Tree().CostCap());
+                }
+
+                // If the search is to continue, either process the node, or push it again with its
+                // current key if its key was computed before the sample moved.
+                if (searching) {
+                    queue_.pop();
+                    const Key key = CalculateKey(coords);
+                    if (queueNode.key < key) {
+                        node.key = key;
+                        queue_.push({ coords, key });
+                        CountStatistic(Tree().Statistics().pushes);
+                    }
+                    else {
+                        node.open = false;
+                        ProcessSearchNode(coords);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <int L>
+void IncrementalSearch<L>::ProcessSearchNode(Offset2D coords)
+{
+    CountStatistic(Tree().Statistics().expansions);
+    const PathCost gCost = Tree().GCost(coords);
+    const PathCost rhs = nodes_[coords].rhs;
+    const Connections<L> neighbors = Grid().Neighbors(coords);
+    if (gCost > rhs) {
+        // The node is overconsistent. Lower its g-cost to the rhs-value and relax the moves to its neighbors.
+        Tree().SetGCost(coords, rhs);
+        for (const Move<L>& move : neighbors) {
+            const Offset2D neighborCoords = coords + move.Offset();
+            InitializeIncrementalNode(neighborCoords);
+            const PathCost neighborRhs = rhs + move.Cost();
+            if (!Tree().IsSource(neighborCoords) && neighborRhs < nodes_[neighborCoords].rhs) {
+                nodes_[neighborCoords].rhs = neighborRhs;
+                Tree().SetParentMove(neighborCoords, -move);
+                UpdateQueue(neighborCoords);
+            }
+        }
+    }
+    else {
+        // The node is underconsistent. Raise its g-cost to infinity, and recompute the rhs-values of
+        // the node itself and of any neighbors whose rhs-values depended on its previous g-cost.
+        Tree().SetGCost(coords, PathCost::MaxCost());
+        for (const Move<L>& move : neighbors) {
+            const Offset2D neighborCoords = coords + move.Offset();
+            InitializeIncrementalNode(neighborCoords);
+            if (nodes_[neighborCoords].rhs == gCost + move.Cost()) {
+                ComputeRhs(neighborCoords);
+                UpdateQueue(neighborCoords);
+            }
+        }
+        ComputeRhs(coords);
+        UpdateQueue(coords);
+    }
+}
+
+template <int L>
+inline void IncrementalSearch<L>::InitializeIncrementalNode(Offset2D coords)
+{
+    if (!IsSearchNodeInitialized(coords)) {
+        InitializeDijkstraNode(coords);
+        nodes_[coords] = IncrementalNode{ PathCost::MaxCost() };
+    }
+}
+
+template <int L>
+inline typename IncrementalSearch<L>::Key IncrementalSearch<L>::CalculateKey(Offset2D coords) const
+{
+    const PathCost minCost = std::min(Tree().GCost(coords), nodes_[coords].rhs);
+    if (minCost == PathCost::MaxCost()) {
+        return { PathCost::MaxCost(), PathCost::MaxCost() };
+    }
+    const PathCost hCost = Tree().Heuristic(coords);
+    return { minCost + hCost + keyModifier_, minCost };
+}
+
+template <int L>
+void IncrementalSearch<L>::ComputeRhs(Offset2D coords)
+{
+    if (!Tree().IsSource(coords)) {
+        PathCost rhs = PathCost::MaxCost();
+        const Connections<L> neighbors = Grid().Neighbors(coords);
+        for (const Move<L>& move : neighbors) {
+            const PathCost neighborGCost = Tree().GCost(coords + move.Offset());
+            if (neighborGCost != PathCost::MaxCost() && neighborGCost + move.Cost() < rhs) {
+                rhs = neighborGCost + move.Cost();
+                Tree().SetParentMove(coords, move);
+            }
+        }
+        nodes_[coords].rhs = rhs;
+    }
+}
+
+template <int L>
+inline void IncrementalSearch<L>::UpdateQueue(Offset2D coords)
+{
+    IncrementalNode& node = nodes_[coords];
+    if (Tree().GCost(coords) != node.rhs) {
+        const Key key = CalculateKey(coords);
+        if (!node.open || node.key != key) {
+            node.key = key;
+            node.open = true;
+            queue_.push({ coords, key });
+            CountStatistic(Tree().Statistics().pushes);
+        }
+    }
+    else {
+        node.open = false;
+    }
+}
+
+}  // namespace
+
+#endif
@@ -15,16 +15,19 @@ public:
     /// where the jump cost is optionally bounded by `jumpCost`. The default maximum
     /// jump cost specifies a conventional jump point search, whereas a lower jump cost
     /// specifies a bounded jump point search. A bounded jump point search with a jump
-    /// cost of zero is also known as Canonical A*.
-    explicit JumpPointSearch(const Grid2D<L>& grid, PathCost jumpCost = PathCost::MaxCost());
+    /// cost of zero is also known as Canonical A*. If `adaptive` is true, the jump cost
+    /// is taken to have been selected for the map by calibration, which is reflected in
+    /// the method names.
+    explicit JumpPointSearch(const Grid2D<L>& grid, PathCost jumpCost = PathCost::MaxCost(), bool adaptive = false);
 
     JumpPointSearch(JumpPointSearch&&) = default;             ///< Ensure the default move constructor is public.
     JumpPointSearch& operator=(JumpPointSearch&&) = default;  ///< Ensure the default move assignment operator is public.
 
     const PathCost JumpCost() const { return jumpCost_; }  ///< Get the jump cost.
+    bool IsAdaptive() const { return adaptive_; }          ///< Check whether the jump cost was selected for the map by calibration.
 
-    std::string MethodName() const;          ///< Get the name of the search method, which depends on whether the search is bounded.
-    std::string AllNodesMethodName() const;  ///< Get the name of the all-nodes version of the search method, which depends on whether the search is bounded.
+    std::string MethodName() const;          ///< Get the name of the search method, which depends on whether the search is bounded and adaptive.
+    std::string AllNodesMethodName() const;  ///< Get the name of the all-nodes version of the search method, which depends on whether the search is bounded and adaptive.
 
     const Grid2D<L>& Grid() const { return BasicSearch<L>::Grid(); }
     bool IsAllNodesSearch() const { return BasicSearch<L>::IsAllNodesSearch(); }
@@ -45,6 +48,16 @@ private:
     // jump must be expanded.
     void Jump(Offset2D initialCoords, PathCost maxGCost, bool activeFrontier);
 
+    // Visit the node at coordinates `coords`, with g-cost `gCost`, during a jump traversal from the parent
+    // direction `parentMove`. If the traversal terminates at the node, expand the node if required and
+    // return false. Otherwise obtain the node's `canonicalSuccessors` and return true.
+    bool VisitJumpNode(Offset2D coords, const Move<L>& parentMove, PathCost gCost, PathCost maxGCost, bool activeFrontier, Connections<L>& canonicalSuccessors);
+
+    // Advance a jump traversal from the node at coordinates `coords`, with g-cost `gCost`, by one move in
+    // the direction `forwardMove`, and update both arguments. Return true if the next node is a canonical
+    // successor whose path is improved, in which case the traversal is to continue.
+    bool AdvanceJump(Offset2D& coords, const Move<L>& forwardMove, PathCost& gCost, Connections<L> canonicalSuccessors);
+
     bool IsSearchNodeInitialized(Offset2D coords) const { return BasicSearch<L>::IsSearchNodeInitialized(coords); }
     void InitializeDijkstraNode(Offset2D coords) { BasicSearch<L>::InitializeDijkstraNode(coords); }
     void InitializeHeuristicNode(Offset2D coords) { BasicSearch<L>::InitializeHeuristicNode(coords); }
@@ -56,12 +69,14 @@ private:
     void ExpandSearchNode(Offset2D coords, Connections<L> successors) { BasicSearch<L>::ExpandSearchNode(coords, successors); }
 
     PathCost jumpCost_;
+    bool adaptive_;
 };
 
 template <int L>
-JumpPointSearch<L>::JumpPointSearch(const Grid2D<L>& grid, PathCost jumpCost)
+JumpPointSearch<L>::JumpPointSearch(const Grid2D<L>& grid, PathCost jumpCost, bool adaptive)
     : BasicSearch<L>{ grid }
     , jumpCost_{ jumpCost }
+    , adaptive_{ adaptive }
 {
 }
 
@@ -69,21 +84,23 @@ template <int L>
 inline std::string JumpPointSearch<L>::MethodName() const
 {
     return (jumpCost_ == PathCost::MaxCost()) ? "Jump Point Search" :
+                                    adaptive_ ? "Adaptive Bounded Jump Point Search" :
                                                 "Bounded Jump Point Search";
 }
 
 template <int L>
 inline std::string JumpPointSearch<L>::AllNodesMethodName() const
 {
-    return (jumpCost_ == PathCost::MaxCost()) ? "Canonical Dijkstra Search" : 
+    return (jumpCost_ == PathCost::MaxCost()) ? "Canonical Dijkstra Search" :
+                                    adaptive_ ? "Adaptive Bounded Canonical Dijkstra Search" :
                                                 "Bounded Canonical Dijkstra Search";
 }
 
 template <int L>
 bool JumpPointSearch<L>::ProcessSearchNode(Offset2D coords, PathCost fCost)
 {
-    // Obtain the current g-cost of the sample node, if it exists.
-    const PathCost sampleCost = IsAllNodesSearch() ? PathCost::MaxCost() : Tree().GCost(SampleCoords());
+    // Obtain the current g-cost of the sample node, or the cost cap of an all-nodes search.
+    const PathCost sampleCost = IsAllNodesSearch() ? Tree().CostCap() : Tree().GCost(SampleCoords());
 
     // Terminate the search if the current f-cost has exceeded the g-cost of the sample.
     const bool searching = (fCost <= sampleCost);
@@ -100,72 +117,99 @@ bool JumpPointSearch<L>::ProcessSearchNode(Offset2D coords, PathCost fCost)
 template <int L>
 void JumpPointSearch<L>::Jump(Offset2D initialCoords, PathCost maxGCost, bool activeFrontier)
 {
-    const Move<L>& parentMove = Tree().ParentMove(initialCoords);
+    // The traversal in the initial direction forms the outer loop. If the initial direction is odd,
+    // the traversals initiated from its canonical successors in other directions form the inner loop.
+    // These directions are even, and traversals in even directions initiate no further traversals,
+    // so the nodes are visited in the same order as a recursive implementation, without recursion.
+    const Move<L> parentMove = Tree().ParentMove(initialCoords);
     const Move<L> forwardMove = -parentMove;
     Offset2D coords = initialCoords;
     bool jumping = true;
     while (jumping) {
-        const Connections<L> canonicalSuccessors = Grid().CanonicalSuccessors(coords, parentMove);
-        const Connections<L> forcedSuccessors = Grid().ForcedSuccessors(coords, parentMove);
         PathCost gCost = Tree().GCost(coords);
-        if (!forcedSuccessors.IsAllDisconnected() || gCost >= maxGCost) {
-            // Either forced successors have been encountered, or the maximum g-cost for
-            // this jump has been reached. If forced successors have been encountered,
-            // or if the frontier is active, then expand the current node. Either way,
-            // terminate the jump traversal.
-            if (gCost < maxGCost || activeFrontier) {
-                ExpandSearchNode(coords, forcedSuccessors | canonicalSuccessors);
-            }
-            jumping = false;
-        }
-        else {
+        Connections<L> canonicalSuccessors{};
+        jumping = VisitJumpNode(coords, parentMove, gCost, maxGCost, activeFrontier, canonicalSuccessors);
+        if (jumping) {
             // The jump traversal is to continue. If the forward direction of the traversal 
             // is odd, then initialize and update any canonical successors that are not in
-            // the forward direction. Initiate a jump traversal in these even directions.
+            // the forward direction. Perform a jump traversal in each of these even directions.
             if (forwardMove.IsOdd()) {
-                for (const Move<L>& move : Neighborhood<L>::Moves()) {
-                    if (canonicalSuccessors.IsConnected(move)) {
-                        if (move != forwardMove) {
-                            const Offset2D successorCoords = coords + move.Offset();
-                            if (!IsSearchNodeInitialized(successorCoords)) {
-                                InitializeHeuristicNode(successorCoords);
-                            }
-                            const PathCost successorGCost = gCost + move.Cost();
-                            if (successorGCost < Tree().GCost(successorCoords)) {
-                                Tree().SetGCost(successorCoords, successorGCost);
-                                Tree().SetParentMove(successorCoords, -move);
-                                Jump(successorCoords, maxGCost, activeFrontier);
+                for (const Move<L>& move : canonicalSuccessors) {
+                    if (move != forwardMove) {
+                        assert(!move.IsOdd());
+                        const Offset2D successorCoords = coords + move.Offset();
+                        if (!IsSearchNodeInitialized(successorCoords)) {
+                            InitializeHeuristicNode(successorCoords);
+                        }
+                        const PathCost successorGCost = gCost + move.Cost();
+                        if (successorGCost < Tree().GCost(successorCoords)) {
+                            Tree().SetGCost(successorCoords, successorGCost);
+                            Tree().SetParentMove(successorCoords, -move);
+                            Offset2D sideCoords = successorCoords;
+                            bool sideJumping = true;
+                            while (sideJumping) {
+                                PathCost sideGCost = Tree().GCost(sideCoords);
+                                Connections<L> sideCanonicalSuccessors{};
+                                sideJumping = VisitJumpNode(sideCoords, -move, sideGCost, maxGCost, activeFrontier, sideCanonicalSuccessors);
+                                if (sideJumping) {
+                                    sideJumping = AdvanceJump(sideCoords, move, sideGCost, sideCanonicalSuccessors);
+                                }
                             }
                         }
                     }
                 }
             }
 
-            // If there is no canonical successor in the forward direction,
-            // terminate the jump traversal. Otherwise, advance by one move
-            // in the forward direction.
-            if (!canonicalSuccessors.IsConnected(forwardMove)) {
-                jumping = false;
-            }
-            else {
-                // Advance to the next node and ensure it is initialized.
-                coords += forwardMove.Offset();
-                if (!IsSearchNodeInitialized(coords)) {
-                    InitializeHeuristicNode(coords);
-                }
-                
-                // Obtain the g-cost of a path to the current node from the previous node.
-                // If this is now the shortest path to the current node, update the path tree
-                // and continue the jump traversal.
-                gCost += forwardMove.Cost();
-                jumping = (gCost < Tree().GCost(coords));
-                if (jumping) {
-                    Tree().SetGCost(coords, gCost);
-                    Tree().SetParentMove(coords, parentMove);
-                }
-            }
+            // Advance the traversal in the forward direction, if possible.
+            jumping = AdvanceJump(coords, forwardMove, gCost, canonicalSuccessors);
+        }
+    }
+}
+
+template <int L>
+inline bool JumpPointSearch<L>::VisitJumpNode(Offset2D coords, const Move<L>& parentMove, PathCost gCost, PathCost maxGCost, bool activeFrontier, Connections<L>& canonicalSuccessors)
+{
+    CountStatistic(Tree().Statistics().jumpCells);
+    canonicalSuccessors = Grid().CanonicalSuccessors(coords, parentMove);
+    const Connections<L> forcedSuccessors = Grid().ForcedSuccessors(coords, parentMove);
+    const bool jumping = (forcedSuccessors.IsAllDisconnected() && gCost < maxGCost);
+    if (!jumping) {
+        // Either forced successors have been encountered, or the maximum g-cost for
+        // this jump has been reached. If forced successors have been encountered,
+        // or if the frontier is active, then expand the current node. Either way,
+        // terminate the jump traversal.
+        if (gCost < maxGCost || activeFrontier) {
+            ExpandSearchNode(coords, forcedSuccessors | canonicalSuccessors);
+        }
+    }
+    return jumping;
+}
+
+template <int L>
+inline bool JumpPointSearch<L>::AdvanceJump(Offset2D& coords, const Move<L>& forwardMove, PathCost& gCost, Connections<L> canonicalSuccessors)
+{
+    // If there is no canonical successor in the forward direction,
+    // terminate the jump traversal. Otherwise, advance by one move
+    // in the forward direction.
+    bool jumping = canonicalSuccessors.IsConnected(forwardMove);
+    if (jumping) {
+        // Advance to the next node and ensure it is initialized.
+        coords += forwardMove.Offset();
+        if (!IsSearchNodeInitialized(coords)) {
+            InitializeHeuristicNode(coords);
+        }
+
+        // Obtain the g-cost of a path to the current node from the previous node.
+        // If this is now the shortest path to the current node, update the path tree
+        // and continue the jump traversal.
+        gCost += forwardMove.Cost();
+        jumping = (gCost < Tree().GCost(coords));
+        if (jumping) {
+            Tree().SetGCost(coords, gCost);
+            Tree().SetParentMove(coords, -forwardMove);
         }
     }
+    return jumping;
 }
 
 }  // namespace
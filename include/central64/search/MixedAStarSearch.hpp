@@ -11,7 +11,7 @@ template <int L, int M = 8>
 class MixedAStarSearch : public MixedSearch<L, M>
 {
 public:
-    explicit MixedAStarSearch(const Grid2D<L>& grid) : MixedSearch<L>{ grid } {}  ///< Create a mixed A* search object that references an existing grid object.
+    explicit MixedAStarSearch(const Grid2D<L>& grid, int threadCount = 1) : MixedSearch<L, M>{ grid, threadCount } {}  ///< Create a mixed A* search object that references an existing grid object, and processes the blocks of all-nodes searches across `threadCount` threads.
 
     MixedAStarSearch(MixedAStarSearch&&) = default;             ///< Ensure the default move constructor is public.
     MixedAStarSearch& operator=(MixedAStarSearch&&) = default;  ///< Ensure the default move assignment operator is public.
@@ -19,35 +19,36 @@ public:
     std::string MethodName() const { return "Mixed A* Search"; }                ///< Get the name of the search method.
     std::string AllNodesMethodName() const { return "Mixed Dijkstra Search"; }  ///< Get the name of the all-nodes version of the search method.
 
-    const Grid2D<L>& Grid() const { return MixedSearch<L>::Grid(); }
-    bool IsAllNodesSearch() const { return MixedSearch<L>::IsAllNodesSearch(); }
-    Offset2D SourceCoords() const { return MixedSearch<L>::SourceCoords(); }
-    Offset2D SampleCoords() const { return MixedSearch<L>::SampleCoords(); }
-    bool Centralize() const { return MixedSearch<L>::Centralize(); }
-    bool FromSource() const { return MixedSearch<L>::FromSource(); }
-    PathTree<L>& Tree() const { return MixedSearch<L>::Tree(); }
-    PathFlow<L>& Flow() const { return MixedSearch<L>::Flow(); }
+    const Grid2D<L>& Grid() const { return MixedSearch<L, M>::Grid(); }
+    int ThreadCount() const { return MixedSearch<L, M>::ThreadCount(); }
+    bool IsAllNodesSearch() const { return MixedSearch<L, M>::IsAllNodesSearch(); }
+    Offset2D SourceCoords() const { return MixedSearch<L, M>::SourceCoords(); }
+    Offset2D SampleCoords() const { return MixedSearch<L, M>::SampleCoords(); }
+    bool Centralize() const { return MixedSearch<L, M>::Centralize(); }
+    bool FromSource() const { return MixedSearch<L, M>::FromSource(); }
+    PathTree<L>& Tree() const { return MixedSearch<L, M>::Tree(); }
+    PathFlow<L>& Flow() const { return MixedSearch<L, M>::Flow(); }
 
 private:
     // Process the node at coordinates `coords`.
     void ProcessSearchNode(Offset2D coords);
 
-    bool IsSearchNodeInitialized(Offset2D coords) const { return MixedSearch<L>::IsSearchNodeInitialized(coords); }
-    void InitializeDijkstraNode(Offset2D coords) { MixedSearch<L>::InitializeDijkstraNode(coords); }
-    void InitializeHeuristicNode(Offset2D coords) { MixedSearch<L>::InitializeHeuristicNode(coords); }
-    using DijkstraQueue = typename MixedSearch<L>::DijkstraQueue;
-    using HeuristicQueue = typename MixedSearch<L>::HeuristicQueue;
-    DijkstraQueue CreateDijkstraQueue() { return MixedSearch<L>::CreateDijkstraQueue(); }
-    HeuristicQueue CreateHeuristicQueue() { return MixedSearch<L>::CreateHeuristicQueue(); }
+    bool IsSearchNodeInitialized(Offset2D coords) const { return MixedSearch<L, M>::IsSearchNodeInitialized(coords); }
+    void InitializeDijkstraNode(Offset2D coords) { MixedSearch<L, M>::InitializeDijkstraNode(coords); }
+    void InitializeHeuristicNode(Offset2D coords) { MixedSearch<L, M>::InitializeHeuristicNode(coords); }
+    using DijkstraQueue = typename MixedSearch<L, M>::DijkstraQueue;
+    using HeuristicQueue = typename MixedSearch<L, M>::HeuristicQueue;
+    DijkstraQueue CreateDijkstraQueue() { return MixedSearch<L, M>::CreateDijkstraQueue(); }
+    HeuristicQueue CreateHeuristicQueue() { return MixedSearch<L, M>::CreateHeuristicQueue(); }
 
-    bool IsSearchBlockInitialized(Offset2D compressedCoords) const { return MixedSearch<L>::IsSearchBlockInitialized(compressedCoords); }
-    void InitializeSearchBlock(Offset2D compressedCoords) { MixedSearch<L>::InitializeSearchBlock(compressedCoords); }
-    void ExpandSearchNode(Offset2D coords, Connections<L> successors) { MixedSearch<L>::ExpandSearchNode(coords, successors); }
-    void UpdateBorderNode(Offset2D coords) { MixedSearch<L>::UpdateBorderNode(coords); }
-    Offset2D CompressedDims() const { return MixedSearch<L>::CompressedDims(); }
-    Offset2D ContainingDims(Offset2D compressedCoords) const { return MixedSearch<L>::ContainingDims(compressedCoords); }
-    Offset2D CompressCoords(Offset2D coords) const { return MixedSearch<L>::CompressCoords(coords); }
-    Offset2D DecompressCoords(Offset2D compressedCoords) const { return MixedSearch<L>::DecompressCoords(compressedCoords); }
+    bool IsSearchBlockInitialized(Offset2D compressedCoords) const { return MixedSearch<L, M>::IsSearchBlockInitialized(compressedCoords); }
+    void InitializeSearchBlock(Offset2D compressedCoords) { MixedSearch<L, M>::InitializeSearchBlock(compressedCoords); }
+    void ExpandSearchNode(Offset2D coords, Connections<L> successors) { MixedSearch<L, M>::ExpandSearchNode(coords, successors); }
+    void UpdateBorderNode(Offset2D coords) { MixedSearch<L, M>::UpdateBorderNode(coords); }
+    Offset2D CompressedDims() const { return MixedSearch<L, M>::CompressedDims(); }
+    Offset2D ContainingDims(Offset2D compressedCoords) const { return MixedSearch<L, M>::ContainingDims(compressedCoords); }
+    Offset2D CompressCoords(Offset2D coords) const { return MixedSearch<L, M>::CompressCoords(coords); }
+    Offset2D DecompressCoords(Offset2D compressedCoords) const { return MixedSearch<L, M>::DecompressCoords(compressedCoords); }
 };
 
 template <int L, int M>
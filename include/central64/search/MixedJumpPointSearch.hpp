@@ -11,7 +11,7 @@ template <int L, int M = 8>
 class MixedJumpPointSearch : public MixedSearch<L, M>
 {
 public:
-    explicit MixedJumpPointSearch(const Grid2D<L>& grid) : MixedSearch<L>{ grid } {}  ///< Create a mixed jump point search object that references an existing grid object.
+    explicit MixedJumpPointSearch(const Grid2D<L>& grid) : MixedSearch<L, M>{ grid } {}  ///< Create a mixed jump point search object that references an existing grid object.
 
     MixedJumpPointSearch(MixedJumpPointSearch&&) = default;             ///< Ensure the default move constructor is public.
     MixedJumpPointSearch& operator=(MixedJumpPointSearch&&) = default;  ///< Ensure the default move assignment operator is public.
@@ -19,14 +19,14 @@ public:
     std::string MethodName() const { return "Mixed Jump Point Search"; }                  ///< Get the name of the search method.
     std::string AllNodesMethodName() const { return "Mixed Canonical Dijkstra Search"; }  ///< Get the name of the all-nodes version of the search method.
 
-    const Grid2D<L>& Grid() const { return MixedSearch<L>::Grid(); }
-    bool IsAllNodesSearch() const { return MixedSearch<L>::IsAllNodesSearch(); }
-    Offset2D SourceCoords() const { return MixedSearch<L>::SourceCoords(); }
-    Offset2D SampleCoords() const { return MixedSearch<L>::SampleCoords(); }
-    bool Centralize() const { return MixedSearch<L>::Centralize(); }
-    bool FromSource() const { return MixedSearch<L>::FromSource(); }
-    PathTree<L>& Tree() const { return MixedSearch<L>::Tree(); }
-    PathFlow<L>& Flow() const { return MixedSearch<L>::Flow(); }
+    const Grid2D<L>& Grid() const { return MixedSearch<L, M>::Grid(); }
+    bool IsAllNodesSearch() const { return MixedSearch<L, M>::IsAllNodesSearch(); }
+    Offset2D SourceCoords() const { return MixedSearch<L, M>::SourceCoords(); }
+    Offset2D SampleCoords() const { return MixedSearch<L, M>::SampleCoords(); }
+    bool Centralize() const { return MixedSearch<L, M>::Centralize(); }
+    bool FromSource() const { return MixedSearch<L, M>::FromSource(); }
+    PathTree<L>& Tree() const { return MixedSearch<L, M>::Tree(); }
+    PathFlow<L>& Flow() const { return MixedSearch<L, M>::Flow(); }
 
 private:
     // Process the node at coordinates `coords`.
@@ -34,22 +34,22 @@ private:
 
     void Jump(Offset2D initialCoords, Offset2D initialCompressedCoords);
 
-    bool IsSearchNodeInitialized(Offset2D coords) const { return MixedSearch<L>::IsSearchNodeInitialized(coords); }
-    void InitializeDijkstraNode(Offset2D coords) { MixedSearch<L>::InitializeDijkstraNode(coords); }
-    void InitializeHeuristicNode(Offset2D coords) { MixedSearch<L>::InitializeHeuristicNode(coords); }
-    using DijkstraQueue = typename MixedSearch<L>::DijkstraQueue;
-    using HeuristicQueue = typename MixedSearch<L>::HeuristicQueue;
-    DijkstraQueue CreateDijkstraQueue() { return MixedSearch<L>::CreateDijkstraQueue(); }
-    HeuristicQueue CreateHeuristicQueue() { return MixedSearch<L>::CreateHeuristicQueue(); }
-
-    bool IsSearchBlockInitialized(Offset2D compressedCoords) const { return MixedSearch<L>::IsSearchBlockInitialized(compressedCoords); }
-    void InitializeSearchBlock(Offset2D compressedCoords) { MixedSearch<L>::InitializeSearchBlock(compressedCoords); }
-    void ExpandSearchNode(Offset2D coords, Connections<L> successors) { MixedSearch<L>::ExpandSearchNode(coords, successors); }
-    void UpdateBorderNode(Offset2D coords) { MixedSearch<L>::UpdateBorderNode(coords); }
-    Offset2D CompressedDims() const { return MixedSearch<L>::CompressedDims(); }
-    Offset2D ContainingDims(Offset2D compressedCoords) const { return MixedSearch<L>::ContainingDims(compressedCoords); }
-    Offset2D CompressCoords(Offset2D coords) const { return MixedSearch<L>::CompressCoords(coords); }
-    Offset2D DecompressCoords(Offset2D compressedCoords) const { return MixedSearch<L>::DecompressCoords(compressedCoords); }
+    bool IsSearchNodeInitialized(Offset2D coords) const { return MixedSearch<L, M>::IsSearchNodeInitialized(coords); }
+    void InitializeDijkstraNode(Offset2D coords) { MixedSearch<L, M>::InitializeDijkstraNode(coords); }
+    void InitializeHeuristicNode(Offset2D coords) { MixedSearch<L, M>::InitializeHeuristicNode(coords); }
+    using DijkstraQueue = typename MixedSearch<L, M>::DijkstraQueue;
+    using HeuristicQueue = typename MixedSearch<L, M>::HeuristicQueue;
+    DijkstraQueue CreateDijkstraQueue() { return MixedSearch<L, M>::CreateDijkstraQueue(); }
+    HeuristicQueue CreateHeuristicQueue() { return MixedSearch<L, M>::CreateHeuristicQueue(); }
+
+    bool IsSearchBlockInitialized(Offset2D compressedCoords) const { return MixedSearch<L, M>::IsSearchBlockInitialized(compressedCoords); }
+    void InitializeSearchBlock(Offset2D compressedCoords) { MixedSearch<L, M>::InitializeSearchBlock(compressedCoords); }
+    void ExpandSearchNode(Offset2D coords, Connections<L> successors) { MixedSearch<L, M>::ExpandSearchNode(coords, successors); }
+    void UpdateBorderNode(Offset2D coords) { MixedSearch<L, M>::UpdateBorderNode(coords); }
+    Offset2D CompressedDims() const { return MixedSearch<L, M>::CompressedDims(); }
+    Offset2D ContainingDims(Offset2D compressedCoords) const { return MixedSearch<L, M>::ContainingDims(compressedCoords); }
+    Offset2D CompressCoords(Offset2D coords) const { return MixedSearch<L, M>::CompressCoords(coords); }
+    Offset2D DecompressCoords(Offset2D compressedCoords) const { return MixedSearch<L, M>::DecompressCoords(compressedCoords); }
 };
 
 template <int L, int M>
@@ -69,6 +69,7 @@ void MixedJumpPointSearch<L, M>::Jump(Offset2D initialCoords, Offset2D initialCo
     Offset2D coords = initialCoords;
     bool jumping = true;
     while (jumping) {
+        CountStatistic(Tree().Statistics().jumpCells);
         const Connections<L> canonicalSuccessors = Grid().CanonicalSuccessors(coords, parentMove);
         const Connections<L> forcedSuccessors = Grid().ForcedSuccessors(coords, parentMove);
         Offset2D compressedCoords = CompressCoords(coords);
@@ -94,20 +95,21 @@ void MixedJumpPointSearch<L, M>::Jump(Offset2D initialCoords, Offset2D initialCo
                 // update any canonical successors that are not in the forward direction.
                 // Initiate a jump traversal in these even directions.
                 if (forwardMove.IsOdd()) {
-                    for (const Move<L>& move : Neighborhood<L>::Moves()) {
-                        if (canonicalSuccessors.IsConnected(move)) {
-                            if (move != forwardMove) {
-                                const Offset2D successorCoords = coords + move.Offset();
-                                const Offset2D successorCompressedCoords = CompressCoords(successorCoords);
-                                if (!IsSearchBlockInitialized(successorCompressedCoords)) {
-                                    InitializeSearchBlock(successorCompressedCoords);
-                                }
-                                const PathCost successorGCost = gCost + move.Cost();
-                                if (successorGCost < Tree().GCost(successorCoords)) {
-                                    Tree().SetGCost(successorCoords, successorGCost);
-                                    Tree().SetParentMove(successorCoords, -move);
-                                    Jump(successorCoords, initialCompressedCoords);
+                    for (const Move<L>& move : canonicalSuccessors) {
+                        if (move != forwardMove) {
+                            const Offset2D successorCoords = coords + move.Offset();
+                            const Offset2D successorCompressedCoords = CompressCoords(successorCoords);
+                            if (!IsSearchBlockInitialized(successorCompressedCoords)) {
+                                InitializeSearchBlock(successorCompressedCoords);
+                            }
+                            const PathCost successorGCost = gCost + move.Cost();
+                            if (successorGCost < Tree().GCost(successorCoords)) {
+                                if (!IsSearchNodeInitialized(successorCoords)) {
+                                    InitializeHeuristicNode(successorCoords);
                                 }
+                                Tree().SetGCost(successorCoords, successorGCost);
+                                Tree().SetParentMove(successorCoords, -move);
+                                Jump(successorCoords, initialCompressedCoords);
                             }
                         }
                     }
@@ -133,6 +135,9 @@ void MixedJumpPointSearch<L, M>::Jump(Offset2D initialCoords, Offset2D initialCo
                     gCost += forwardMove.Cost();
                     jumping = (gCost < Tree().GCost(coords));
                     if (jumping) {
+                        if (!IsSearchNodeInitialized(coords)) {
+                            InitializeHeuristicNode(coords);
+                        }
                         Tree().SetGCost(coords, gCost);
                         Tree().SetParentMove(coords, parentMove);
                     }
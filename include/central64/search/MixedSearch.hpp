@@ -3,6 +3,9 @@
 #define CENTRAL64_MIXED_SEARCH
 
 #include <central64/search/AbstractSearch.hpp>
+#include <central64/search/WorkerPool.hpp>
+#include <atomic>
+#include <memory>
 
 namespace central64 {
 
@@ -10,6 +13,9 @@ namespace central64 {
 /// A mixed search partitions the grid into `M`-by-`M` search blocks.
 /// A heuristic search is employed at the outer level, between blocks.
 /// An all-nodes search is employed at the inner level, within blocks.
+/// If more than one thread is requested, the blocks of all-nodes searches are processed in parallel batches
+/// by a pool of worker threads that is created along with the search object and reused by every search.
+/// This requires that processing a node simply expands it, as in the mixed A* search.
 template <int L, int M = 8>
 class MixedSearch : public AbstractSearch<L>
 {
@@ -28,8 +34,10 @@ public:
     PathTree<L>& Tree() const { return AbstractSearch<L>::Tree(); }
     PathFlow<L>& Flow() const { return AbstractSearch<L>::Flow(); }
 
+    int ThreadCount() const { return threadCount_; }  ///< Get the number of threads across which the blocks of all-nodes searches are processed.
+
 protected:
-    explicit MixedSearch(const Grid2D<L>& grid);  ///< Create a mixed search object that references an existing grid object.
+    explicit MixedSearch(const Grid2D<L>& grid, int threadCount = 1);  ///< Create a mixed search object that references an existing grid object, and processes the blocks of all-nodes searches across `threadCount` threads.
 
     MixedSearch(MixedSearch&&) = default;             ///< Ensure the default move constructor is protected because the class is to be inherited.
     MixedSearch& operator=(MixedSearch&&) = default;  ///< Ensure the default move assignment operator is protected because the class is to be inherited.
@@ -39,8 +47,8 @@ protected:
 
     virtual void ProcessSearchNode(Offset2D coords) = 0;  ///< Process the node at coordinates `coords`.
 
-    bool IsSearchBlockInitialized(Offset2D compressedCoords) const;  ///< Check whether the block at compressed coordinates `compressedCoords` has been initialized.
-    void InitializeSearchBlock(Offset2D compressedCoords);           ///< Initialize the block at compressed coordinates `compressedCoords`.
+    bool IsSearchBlockInitialized(Offset2D compressedCoords) const;  ///< Check whether the block at compressed coordinates `compressedCoords` has been initialized for the current search.
+    void InitializeSearchBlock(Offset2D compressedCoords);           ///< Initialize the block at compressed coordinates `compressedCoords` in constant time. Its nodes are initialized as they are reached.
 
     void ExpandSearchNode(Offset2D coords, Connections<L> successors);  ///< Expand the node at coordinates `coords` according to the set of `successors`.
     void UpdateBorderNode(Offset2D coords);                             ///< Update the search based on the cost of the border node at coordinates `coords`.
@@ -59,6 +67,30 @@ protected:
     HeuristicQueue CreateHeuristicQueue() { return AbstractSearch<L>::CreateHeuristicQueue(); }
 
 private:
+    // A move from a node to a successor in a different block, which is recorded while
+    // blocks are processed in parallel, and applied once the parallel batch is complete.
+    struct BorderRelaxation {
+        Offset2D successorCoords;
+        int successorIndex;
+        PathCost successorGCost;
+        int parentMoveIndex;
+    };
+
+    // Process the blocks of an all-nodes search in batches. Each batch consists of the blocks with
+    // f-costs within the cheapest move cost of the lowest f-cost, which are processed in parallel.
+    void PerformParallelSearch();
+
+    // Process the block at compressed coordinates `compressedCoords` without modifying any other block,
+    // recording the moves to successors in other blocks in `borderRelaxations`.
+    void ProcessSearchBlockInParallel(Offset2D compressedCoords, std::vector<BorderRelaxation>& borderRelaxations);
+
+    // Expand the node at coordinates `coords` within the block at compressed coordinates `compressedCoords`,
+    // recording the moves to successors in other blocks in `borderRelaxations`.
+    void ExpandBlockNode(Offset2D coords, Offset2D compressedCoords, std::vector<BorderRelaxation>& borderRelaxations);
+
+    // Apply a move to a successor in a different block that was recorded during a parallel batch.
+    void ApplyBorderRelaxation(const BorderRelaxation& borderRelaxation);
+
     static constexpr int innerBits = M - 1;                                      // The set of bits that identify nodes within blocks.
     static constexpr int outerBits = std::numeric_limits<int>::max() - (M - 1);  // The set of bits that identify the blocks themselves.
     
@@ -69,89 +101,126 @@ private:
     Array2D<PathCost> outerFCosts_;                     // A lowest f-cost for each block.
     Array2D<DijkstraQueue> innerSearchQueues_;          // A search queue for each block.
     Array2D<std::vector<Offset2D>> innerBorderQueues_;  // A first-in-first-out queue for border nodes of each block.
+    Array2D<uint64_t> blockSearchIDs_;                  // The ID of the search for which each block was last initialized.
+
+    int threadCount_;                            // The number of threads across which the blocks of all-nodes searches are processed.
+    std::unique_ptr<WorkerPool> workerPool_;     // The worker threads that process blocks alongside the calling thread, if there are multiple threads.
+    Array2D<SearchStatistics> blockStatistics_;  // The statistics recorded by each block if there are multiple threads, to be added to the path tree statistics.
+    Array2D<uint64_t> batchIDs_;                 // The ID of the parallel batch to which each block was last added.
+    uint64_t currentBatchID_;
 };
 
 template <int L, int M>
-MixedSearch<L, M>::MixedSearch(const Grid2D<L>& grid)
+MixedSearch<L, M>::MixedSearch(const Grid2D<L>& grid, int threadCount)
     : AbstractSearch<L>{ grid }
     , compressedDims_{ std::max(0, Grid().Dims().X() - 1)/M + 1, std::max(0, Grid().Dims().Y() - 1)/M + 1 }
     , outerQueue_{ CreateHeuristicQueue() }
     , outerFCosts_{ compressedDims_ }
     , innerSearchQueues_{ compressedDims_, CreateDijkstraQueue() }
     , innerBorderQueues_{ compressedDims_ }
+    , blockSearchIDs_{ compressedDims_, 0 }
+    , threadCount_{ std::max(1, threadCount) }
+    , workerPool_{ (threadCount_ > 1) ? std::make_unique<WorkerPool>(threadCount_ - 1) : nullptr }
+    , blockStatistics_{ (threadCount_ > 1) ? compressedDims_ : Offset2D{ 0, 0 } }
+    , batchIDs_{ (threadCount_ > 1) ? compressedDims_ : Offset2D{ 0, 0 }, 0 }
+    , currentBatchID_{ 0 }
 {
 }
 
 template <int L, int M>
 inline bool MixedSearch<L, M>::IsSearchBlockInitialized(Offset2D compressedCoords) const
 {
-    return IsSearchNodeInitialized(DecompressCoords(compressedCoords));
+    return blockSearchIDs_[compressedCoords] == Tree().SearchID();
 }
 
 template <int L, int M>
 inline void MixedSearch<L, M>::InitializeSearchBlock(Offset2D compressedCoords)
 {
-    const Offset2D cornerCoords = DecompressCoords(compressedCoords);
-    const Offset2D containingDims = ContainingDims(compressedCoords);
-
-    // Initialize every node in the block. Compute the heuristic
-    // to prioritize blocks at the outer level of the search.
-    for (int y = cornerCoords.Y(); y < containingDims.Y(); ++y) {
-        for (int x = cornerCoords.X(); x < containingDims.X(); ++x) {
-            InitializeHeuristicNode({ x, y });
-        }
-    }
+    // Mark the block as initialized. The nodes of the block are not initialized here, but only
+    // when they are first reached, so the heuristic is computed only for the nodes reached.
+    blockSearchIDs_[compressedCoords] = Tree().SearchID();
 
-    // Reset the minimum f-cost and the queues for this block. 
+    // Reset the minimum f-cost and the queues for this block. If there are multiple threads,
+    // the inner queue records its statistics separately for each block.
     outerFCosts_[compressedCoords] = PathCost::MaxCost();
-    innerSearchQueues_[compressedCoords] = CreateDijkstraQueue();
+    innerSearchQueues_[compressedCoords] = (threadCount_ > 1) ? Tree().CreateDijkstraQueue(blockStatistics_[compressedCoords]) : CreateDijkstraQueue();
     innerBorderQueues_[compressedCoords].clear();
 }
 
 template <int L, int M>
 void MixedSearch<L, M>::PerformSearch()
 {
-    // Initialize the block that contains the source node.
-    const Offset2D sourceCompressedCoords = CompressCoords(SourceCoords());
-    InitializeSearchBlock(sourceCompressedCoords);
+    // Initialize the blocks that contain the source nodes.
+    for (const Offset2D& sourceCoords : Tree().Sources()) {
+        const Offset2D sourceCompressedCoords = CompressCoords(sourceCoords);
+        if (!IsSearchBlockInitialized(sourceCompressedCoords)) {
+            InitializeSearchBlock(sourceCompressedCoords);
+        }
+    }
 
-    // If the current search is not an all-nodes search, and if the block
-    // that contains the sample coordinates is different from the block that 
-    // contains the source, initialize the block that contains the sample.
+    // If the current search is not an all-nodes search, initialize
+    // the blocks that contain the sample nodes, if not already initialized.
     if (!IsAllNodesSearch()) {
-        const Offset2D sampleCompressedCoords = CompressCoords(SampleCoords());
-        if (sampleCompressedCoords != sourceCompressedCoords) {
-            InitializeSearchBlock(sampleCompressedCoords);
+        for (const Offset2D& sampleCoords : Tree().Samples()) {
+            const Offset2D sampleCompressedCoords = CompressCoords(sampleCoords);
+            if (!IsSearchBlockInitialized(sampleCompressedCoords)) {
+                InitializeSearchBlock(sampleCompressedCoords);
+            }
         }
     }
 
-    // Create a new main queue to ensure it is empty, and expand the source node.
+    // Create a new main queue to ensure it is empty, and expand the source nodes.
+    // All of the source g-costs are set before any source is expanded.
     outerQueue_ = CreateHeuristicQueue();
-    Tree().SetGCost(SourceCoords(), PathCost(0));
-    ExpandSearchNode(SourceCoords(), Grid().Neighbors(SourceCoords()));
-
-    // Repeatedly process one of the blocks with the lowest f-cost, until 
-    // the queue is empty or the termination condition has been satisfied.
-    bool searching = true;
-    while (searching) {
-        const std::optional<std::pair<Offset2D, PathCost>> outerNode = outerQueue_.Pop();
-        searching = outerNode.has_value();
-        if (searching) {
-            const Offset2D outerCoords = outerNode->first;
-            const PathCost outerFCost = outerNode->second;
+    for (const Offset2D& sourceCoords : Tree().Sources()) {
+        if (!IsSearchNodeInitialized(sourceCoords)) {
+            InitializeHeuristicNode(sourceCoords);
+        }
+        Tree().SetGCost(sourceCoords, PathCost(0));
+    }
+    for (const Offset2D& sourceCoords : Tree().Sources()) {
+        ExpandSearchNode(sourceCoords, Grid().Neighbors(sourceCoords));
+    }
 
-            // Terminate the search if it is not an all-nodes search, and 
-            // if the current f-cost has exceeded the g-cost of the sample.
-            if (!IsAllNodesSearch()) {
-                searching = (outerFCost <= Tree().GCost(SampleCoords()));
+    if (IsAllNodesSearch() && threadCount_ > 1) {
+        // Process the blocks in parallel batches.
+        PerformParallelSearch();
+    }
+    else {
+        // Repeatedly process one of the blocks with the lowest f-cost, until 
+        // the queue is empty or the termination condition has been satisfied.
+        bool searching = true;
+        while (searching) {
+            const std::optional<std::pair<Offset2D, PathCost>> outerNode = outerQueue_.Pop();
+            searching = outerNode.has_value();
+            if (searching) {
+                const Offset2D outerCoords = outerNode->first;
+                const PathCost outerFCost = outerNode->second;
+
+                // Terminate the search if the current f-cost has exceeded the g-cost
+                // of the sample, or the cost cap in the case of an all-nodes search.
+                Tree().UpdateNearestSample();
+                searching = (outerFCost <= (IsAllNodesSearch() ? Tree().CostCap() : Tree().GCost(SampleCoords())));
+
+                // If the search is to continue, process the current block and
+                // reset its minimum f-cost.
+                if (searching) {
+                    const Offset2D compressedCoords = CompressCoords(outerCoords);
+                    ProcessSearchBlock(compressedCoords);
+                    outerFCosts_[compressedCoords] = PathCost::MaxCost();
+                }
             }
+        }
+    }
 
-            // If the search is to continue, process the current block and
-            // reset its minimum f-cost.
-            if (searching) {
-                const Offset2D compressedCoords = CompressCoords(outerCoords);
-                ProcessSearchBlock(compressedCoords);
-                outerFCosts_[compressedCoords] = PathCost::MaxCost();
+    // Add the statistics recorded by each block to those of the path tree.
+    if constexpr (SearchStatistics::enabled) {
+        if (threadCount_ > 1) {
+            for (int y = 0; y < CompressedDims().Y(); ++y) {
+                for (int x = 0; x < CompressedDims().X(); ++x) {
+                    Tree().Statistics() += blockStatistics_[{ x, y }];
+                    blockStatistics_[{ x, y }] = SearchStatistics{};
+                }
             }
         }
     }
@@ -186,33 +255,194 @@ void MixedSearch<L, M>::ProcessSearchBlock(Offset2D compressedCoords)
 }
 
 template <int L, int M>
-void MixedSearch<L, M>::ExpandSearchNode(Offset2D coords, Connections<L> successors)
+void MixedSearch<L, M>::PerformParallelSearch()
 {
-    const PathCost gCost = Tree().GCost(coords);
+    // Obtain the cost of the cheapest move, which determines the range of f-costs in each batch.
+    PathCost minMoveCost = PathCost::MaxCost();
     for (const Move<L>& move : Neighborhood<L>::Moves()) {
-        if (successors.IsConnected(move)) {
-            // Obtain the coordinates of the current successor,
-            // and ensure the encompassing block is initialized.
-            const Offset2D successorCoords = coords + move.Offset();
-            const Offset2D successorCompressedCoords = CompressCoords(successorCoords);
-            if (!IsSearchBlockInitialized(successorCompressedCoords)) {
-                InitializeSearchBlock(successorCompressedCoords);
+        minMoveCost = std::min(minMoveCost, move.Cost());
+    }
+
+    // The blocks of the current batch, and the moves into other blocks recorded while processing each of them.
+    std::vector<Offset2D> batch{};
+    std::vector<std::vector<BorderRelaxation>> batchRelaxations{};
+
+    // Threads claim the blocks of the current batch one at a time, until none remain.
+    std::atomic<int> nextBatchIndex{ 0 };
+    const std::function<void()> processBatch = [&]() {
+        for (int i = nextBatchIndex++; i < int(batch.size()); i = nextBatchIndex++) {
+            ProcessSearchBlockInParallel(batch[i], batchRelaxations[i]);
+        }
+    };
+
+    // Repeatedly form a batch from the blocks with the lowest f-costs, until the queue is empty or the cost cap has been exceeded.
+    bool searching = true;
+    while (searching) {
+        const std::optional<std::pair<Offset2D, PathCost>> outerNode = outerQueue_.Pop();
+        searching = outerNode.has_value() ? (outerNode->second <= Tree().CostCap()) : false;
+        if (searching) {
+            // Add the block with the lowest f-cost to a new batch, followed by every other block with
+            // an f-cost within the cheapest move cost. Each block is added at most once.
+            ++currentBatchID_;
+            batch.clear();
+            batch.push_back(CompressCoords(outerNode->first));
+            batchIDs_[batch.back()] = currentBatchID_;
+            const PathCost maxBatchFCost = std::min(outerNode->second + minMoveCost, Tree().CostCap());
+            bool batching = true;
+            while (batching) {
+                const std::optional<std::pair<Offset2D, PathCost>> nextOuterNode = outerQueue_.Peek();
+                batching = nextOuterNode.has_value() ? (nextOuterNode->second <= maxBatchFCost) : false;
+                if (batching) {
+                    outerQueue_.Pop();
+                    const Offset2D compressedCoords = CompressCoords(nextOuterNode->first);
+                    if (batchIDs_[compressedCoords] != currentBatchID_) {
+                        batchIDs_[compressedCoords] = currentBatchID_;
+                        batch.push_back(compressedCoords);
+                    }
+                }
+            }
+            if (batchRelaxations.size() < batch.size()) {
+                batchRelaxations.resize(batch.size());
+            }
+
+            // Process the blocks of the batch. The calling thread also processes blocks, and the
+            // worker threads are woken only if there is more than one block.
+            nextBatchIndex = 0;
+            if (batch.size() > 1) {
+                workerPool_->Run(processBatch);
+            }
+            else {
+                processBatch();
+            }
+
+            // Reset the minimum f-costs of the processed blocks. Then apply the moves into other blocks
+            // in the order of the batch, so that the results do not depend on the scheduling of threads.
+            // If a block is improved after it was processed, it is pushed onto the outer queue again,
+            // so the g-costs are exact regardless of which blocks are processed together.
+            for (const Offset2D& compressedCoords : batch) {
+                outerFCosts_[compressedCoords] = PathCost::MaxCost();
             }
+            for (size_t i = 0; i < batch.size(); ++i) {
+                for (const BorderRelaxation& borderRelaxation : batchRelaxations[i]) {
+                    ApplyBorderRelaxation(borderRelaxation);
+                }
+                batchRelaxations[i].clear();
+            }
+        }
+    }
+}
 
-            // Obtain the g-cost of a path to the successor via the node being expanded.
-            // If this is now the shortest path to the successor, update the successor
-            // node in the path tree and push it onto the inner queue. Also update the
-            // minimum f-cost and queue at the outer level, if necessary.
-            const PathCost successorGCost = gCost + move.Cost();
-            if (successorGCost < Tree().GCost(successorCoords)) {
-                Tree().SetGCost(successorCoords, successorGCost);
-                Tree().SetParentMove(successorCoords, -move);
-                innerSearchQueues_[successorCompressedCoords].Push(successorCoords);
-                const PathCost successorFCost = successorGCost + Tree().HCost(successorCoords);
-                if (successorFCost < outerFCosts_[successorCompressedCoords]) {
-                    outerFCosts_[successorCompressedCoords] = successorFCost;
-                    outerQueue_.Push(successorCoords);
+template <int L, int M>
+void MixedSearch<L, M>::ProcessSearchBlockInParallel(Offset2D compressedCoords, std::vector<BorderRelaxation>& borderRelaxations)
+{
+    // Border nodes are only queued by jump traversals, which are not supported in parallel.
+    assert(innerBorderQueues_[compressedCoords].empty());
+
+    // Repeatedly expand one of the nodes in the block with the lowest g-cost, until the inner queue is empty.
+    bool searching = true;
+    while (searching) {
+        const std::optional<std::pair<Offset2D, PathCost>> innerSearchNode = innerSearchQueues_[compressedCoords].Pop();
+        searching = innerSearchNode.has_value();
+        if (searching) {
+            const Offset2D coords = innerSearchNode->first;
+            assert(CompressCoords(coords) == compressedCoords);
+            ExpandBlockNode(coords, compressedCoords, borderRelaxations);
+        }
+    }
+}
+
+template <int L, int M>
+void MixedSearch<L, M>::ExpandBlockNode(Offset2D coords, Offset2D compressedCoords, std::vector<BorderRelaxation>& borderRelaxations)
+{
+    CountStatistic(blockStatistics_[compressedCoords].expansions);
+    const int index = Grid().Index(coords);
+    const PathCost gCost = Tree().GCost(index);
+    for (const Move<L>& move : Grid().Neighbors(index)) {
+        // Obtain the coordinates, linear index, and g-cost of the current successor.
+        const Offset2D successorCoords = coords + move.Offset();
+        const int successorIndex = Grid().NeighborIndex(coords, index, move);
+        const PathCost successorGCost = gCost + move.Cost();
+
+        // A successor within the block is updated immediately, as in a serial search. The nodes of other
+        // blocks may be in use by other threads, so a move to a successor in another block is recorded.
+        if (CompressCoords(successorCoords) == compressedCoords) {
+            if (successorGCost < Tree().GCost(successorIndex)) {
+                if (!Tree().IsSearchNodeInitialized(successorIndex)) {
+                    Tree().InitializeHeuristicNode(successorCoords, successorIndex);
                 }
+                Tree().SetGCost(successorIndex, successorGCost);
+                Tree().SetParentMove(successorIndex, -move);
+                innerSearchQueues_[compressedCoords].Push(successorCoords, successorIndex);
+            }
+        }
+        else {
+            borderRelaxations.push_back({ successorCoords, successorIndex, successorGCost, (-move).Index() });
+        }
+    }
+}
+
+template <int L, int M>
+void MixedSearch<L, M>::ApplyBorderRelaxation(const BorderRelaxation& borderRelaxation)
+{
+    // Ensure the encompassing block is initialized.
+    const Offset2D successorCoords = borderRelaxation.successorCoords;
+    const int successorIndex = borderRelaxation.successorIndex;
+    const Offset2D successorCompressedCoords = CompressCoords(successorCoords);
+    if (!IsSearchBlockInitialized(successorCompressedCoords)) {
+        InitializeSearchBlock(successorCompressedCoords);
+    }
+
+    // If this is now the shortest path to the successor, update the successor node in the path tree
+    // and push it onto the inner queue. Also update the minimum f-cost and queue at the outer level.
+    const PathCost successorGCost = borderRelaxation.successorGCost;
+    if (successorGCost < Tree().GCost(successorIndex)) {
+        if (!Tree().IsSearchNodeInitialized(successorIndex)) {
+            Tree().InitializeHeuristicNode(successorCoords, successorIndex);
+        }
+        Tree().SetGCost(successorIndex, successorGCost);
+        Tree().SetParentMove(successorIndex, Neighborhood<L>::Moves()[borderRelaxation.parentMoveIndex]);
+        innerSearchQueues_[successorCompressedCoords].Push(successorCoords, successorIndex);
+        const PathCost successorFCost = successorGCost + Tree().HCost(successorIndex);
+        if (successorFCost < outerFCosts_[successorCompressedCoords]) {
+            outerFCosts_[successorCompressedCoords] = successorFCost;
+            outerQueue_.Push(successorCoords, successorIndex);
+        }
+    }
+}
+
+template <int L, int M>
+void MixedSearch<L, M>::ExpandSearchNode(Offset2D coords, Connections<L> successors)
+{
+    CountStatistic(Tree().Statistics().expansions);
+    const int index = Grid().Index(coords);
+    const PathCost gCost = Tree().GCost(index);
+    for (const Move<L>& move : successors) {
+        // Obtain the coordinates and linear index of the current successor,
+        // and ensure the encompassing block is initialized.
+        const Offset2D successorCoords = coords + move.Offset();
+        const int successorIndex = Grid().NeighborIndex(coords, index, move);
+        const Offset2D successorCompressedCoords = CompressCoords(successorCoords);
+        if (!IsSearchBlockInitialized(successorCompressedCoords)) {
+            InitializeSearchBlock(successorCompressedCoords);
+        }
+
+        // Obtain the g-cost of a path to the successor via the node being expanded.
+        // If this is now the shortest path to the successor, update the successor
+        // node in the path tree and push it onto the inner queue. Also update the
+        // minimum f-cost and queue at the outer level, if necessary. An uninitialized
+        // successor has an infinite g-cost, and is initialized when first improved.
+        const PathCost successorGCost = gCost + move.Cost();
+        if (successorGCost < Tree().GCost(successorIndex)) {
+            if (!Tree().IsSearchNodeInitialized(successorIndex)) {
+                Tree().InitializeHeuristicNode(successorCoords, successorIndex);
+            }
+            Tree().SetGCost(successorIndex, successorGCost);
+            Tree().SetParentMove(successorIndex, -move);
+            innerSearchQueues_[successorCompressedCoords].Push(successorCoords, successorIndex);
+            const PathCost successorFCost = successorGCost + Tree().HCost(successorIndex);
+            if (successorFCost < outerFCosts_[successorCompressedCoords]) {
+                outerFCosts_[successorCompressedCoords] = successorFCost;
+                outerQueue_.Push(successorCoords, successorIndex);
             }
         }
     }
@@ -35,29 +35,37 @@ private:
 
     // Check if counting has been initialized for the node at coordinates `coords`.
     bool IsCountingNodeInitialized(Offset2D coords) const { return countingIDs_[coords] == currentCountingID_; }
+    bool IsCountingNodeInitialized(int index) const { return countingIDs_[index] == currentCountingID_; }
 
-    // Initialize the counting operation for the node at coordinates `coords`.
-    void InitializeCountingNode(Offset2D coords);
+    // Initialize the counting operation for the node at linear index `index`.
+    void InitializeCountingNode(int index);
 
     // Use the g-costs in the path tree to compute the predecessors and successors that form the flow graph.
     // The procedures begins at the sample coordinates `sampleCoords`.
+    // The vertices of the flow graph are recorded in `flowOrder_` in topological order, from source to sample.
     void ConnectAllPaths(Offset2D sampleCoords);
 
-    // Count the number of shortest grid paths for each vertex, in one direction, recording the results in `counts`.
-    // If the sample coordinates are assigned to `sourceCoords` and the predecessors are assigned to `successorGraph`,
-    // then paths are counted from sample to source. This operation must be performed first.
-    // If the source coordinates are assigned to `sourceCoords` and the successors are assigned to `successorGraph`,
-    // then paths are counted from source to sample. This operation must be performed second.
-    void CountPaths(Array2D<PathCount>& counts, Offset2D sourceCoords, const Array2D<Connections<L>>& successorGraph);
+    // Count the number of shortest grid paths for the node at coordinates `coords` and linear index `index`, in one direction,
+    // by summing the `counts` of the nodes that precede it in the `predecessorGraph`.
+    // If the successors are assigned to `predecessorGraph`, then paths are counted from the sample.
+    // If the predecessors are assigned to `predecessorGraph`, then paths are counted from the source.
+    PathCount SumCounts(const TiledArray2D<PathCount>& counts, Offset2D coords, int index, const TiledArray2D<Connections<L>>& predecessorGraph) const;
+
+    // The coordinates and linear index of a vertex in the flow graph.
+    struct FlowVertex {
+        Offset2D coords;
+        int index;
+    };
 
     const Grid2D<L>* gridPtr_;
     PathTree<L>* pathTreePtr_;
-    Array2D<Connections<L>> predecessorGraph_;
-    Array2D<Connections<L>> successorGraph_;
-    Array2D<PathCount> countsFromSource_;
-    Array2D<PathCount> countsFromSample_;
-    Array2D<uint64_t> countingIDs_;
+    TiledArray2D<Connections<L>> predecessorGraph_;
+    TiledArray2D<Connections<L>> successorGraph_;
+    TiledArray2D<PathCount> countsFromSource_;
+    TiledArray2D<PathCount> countsFromSample_;
+    TiledArray2D<uint64_t> countingIDs_;
     uint64_t currentCountingID_;
+    std::vector<FlowVertex> flowOrder_;
 };
 
 template <int L>
@@ -70,6 +78,7 @@ PathFlow<L>::PathFlow(const Grid2D<L>& grid, PathTree<L>& pathTree)
     , countsFromSample_{ grid.Dims() }
     , countingIDs_{ grid.Dims(), 0 }
     , currentCountingID_{ 0 }
+    , flowOrder_{}
 {
 }
 
@@ -108,16 +117,23 @@ std::vector<Offset2D> PathFlow<L>::ExtractCentralPath()
     InitializeCounting();
 
     // Proceed to extract a central grid path only if the search was successful.
-    if (Tree().GCost(Tree().SampleCoords()) < PathCost::MaxCost()) {
+    if (Tree().IsSampleReached()) {
 
         // Use the g-costs produced during the search to construct the flow graph representing all shortest grid paths.
         ConnectAllPaths(Tree().SampleCoords());
         assert(IsCountingNodeInitialized(Tree().SourceCoords()));  // The source should have been reached and initialized.
 
-        // Count paths in both directions. Due to the trick of negating g-costs, paths must 
-        // be counted first from sample to source, and then from source to sample.
-        CountPaths(countsFromSample_, Tree().SampleCoords(), predecessorGraph_);
-        CountPaths(countsFromSource_, Tree().SourceCoords(), successorGraph_);
+        // Count paths in both directions by sweeping over the flow graph in topological order,
+        // first from sample to source, and then from source to sample.
+        assert(flowOrder_.front().coords == Tree().SourceCoords() && flowOrder_.back().coords == Tree().SampleCoords());
+        countsFromSample_[flowOrder_.back().index] = PathCount::UnitCount();
+        for (auto it = flowOrder_.rbegin() + 1; it != flowOrder_.rend(); ++it) {
+            countsFromSample_[it->index] = SumCounts(countsFromSample_, it->coords, it->index, successorGraph_);
+        }
+        countsFromSource_[flowOrder_.front().index] = PathCount::UnitCount();
+        for (auto it = flowOrder_.begin() + 1; it != flowOrder_.end(); ++it) {
+            countsFromSource_[it->index] = SumCounts(countsFromSource_, it->coords, it->index, predecessorGraph_);
+        }
 
         // Begin extracting the central grid path at the sample.
         Offset2D coords = Tree().SampleCoords();
@@ -135,23 +151,21 @@ std::vector<Offset2D> PathFlow<L>::ExtractCentralPath()
             PathCount highestPredecessorCount{};
             Offset2D nextCoords = coords;
             const Connections<L> predecessors = Predecessors(coords);
-            for (const Move<L>& move : Neighborhood<L>::Moves()) {
-                if (predecessors.IsConnected(move)) {
-                    // Obtain the coordinates of the current predecessor.
-                    const Offset2D predecessorCoords = coords + move.Offset();
-
-                    assert(IsCountingNodeInitialized(predecessorCoords));        // The predecessor should have been initialized.
-                    assert(countsFromSource_[predecessorCoords] > PathCount{});  // The predecessor should have at least one shortest grid path from the source.
-                    assert(countsFromSample_[predecessorCoords] > PathCount{});  // The predecessor should have at least one shortest grid path from the sample.
-
-                    // The number of paths that traverse this predecessor is the product of the counts in each direction.
-                    const PathCount predecessorCount = countsFromSource_[predecessorCoords]*countsFromSample_[predecessorCoords];
-
-                    // If the traversal count is the highest so far, record it along with the predecessor coordinates.
-                    if (predecessorCount > highestPredecessorCount) {
-                        highestPredecessorCount = predecessorCount;
-                        nextCoords = predecessorCoords;
-                    }
+            for (const Move<L>& move : predecessors) {
+                // Obtain the coordinates of the current predecessor.
+                const Offset2D predecessorCoords = coords + move.Offset();
+
+                assert(IsCountingNodeInitialized(predecessorCoords));        // The predecessor should have been initialized.
+                assert(countsFromSource_[predecessorCoords] > PathCount{});  // The predecessor should have at least one shortest grid path from the source.
+                assert(countsFromSample_[predecessorCoords] > PathCount{});  // The predecessor should have at least one shortest grid path from the sample.
+
+                // The number of paths that traverse this predecessor is the product of the counts in each direction.
+                const PathCount predecessorCount = countsFromSource_[predecessorCoords]*countsFromSample_[predecessorCoords];
+
+                // If the traversal count is the highest so far, record it along with the predecessor coordinates.
+                if (predecessorCount > highestPredecessorCount) {
+                    highestPredecessorCount = predecessorCount;
+                    nextCoords = predecessorCoords;
                 }
             }
             assert(nextCoords != coords);
@@ -163,102 +177,88 @@ std::vector<Offset2D> PathFlow<L>::ExtractCentralPath()
 }
 
 template <int L>
-inline void PathFlow<L>::InitializeCountingNode(Offset2D coords)
+inline void PathFlow<L>::InitializeCountingNode(int index)
 {
-    countingIDs_[coords] = currentCountingID_;
-    predecessorGraph_[coords].DisconnectAll();
-    successorGraph_[coords].DisconnectAll();
-    countsFromSource_[coords] = PathCount{};
-    countsFromSample_[coords] = PathCount{};
+    countingIDs_[index] = currentCountingID_;
+    predecessorGraph_[index].DisconnectAll();
+    successorGraph_[index].DisconnectAll();
+    countsFromSource_[index] = PathCount{};
+    countsFromSample_[index] = PathCount{};
 }
 
 template <int L>
 void PathFlow<L>::ConnectAllPaths(Offset2D sampleCoords)
 {
-    // Initialize the sample and add it to a stack.
-    InitializeCountingNode(sampleCoords);
-    std::vector<Offset2D> stack{};
-    stack.push_back(sampleCoords);
-
-    // Process the next node in the stack until the stack is empty.
+    // Perform a depth-first traversal of the flow graph from the sample toward the source.
+    // Each entry in the stack holds a vertex and the index of the next move to consider.
+    // A vertex is appended to the flow order once all of its predecessors have been appended,
+    // so the flow order is a topological order from source to sample.
+    flowOrder_.clear();
+    const FlowVertex sample{ sampleCoords, Grid().Index(sampleCoords) };
+    InitializeCountingNode(sample.index);
+    std::vector<std::pair<FlowVertex, int>> stack{};
+    stack.push_back({ sample, 0 });
+
+    // Process the vertex at the top of the stack until the stack is empty.
     while (!stack.empty()) {
-        const Offset2D coords = stack.back();
-        stack.pop_back();
-        const PathCost gCost = Tree().GCost(coords);
-        Connections<L>& predecessors = predecessorGraph_[coords];
-        const Connections<L> neighbors = Grid().Neighbors(coords);
-        for (const Move<L>& move : Neighborhood<L>::Moves()) {
+        const FlowVertex vertex = stack.back().first;
+        int& moveIndex = stack.back().second;
+        const PathCost gCost = Tree().GCost(vertex.index);
+        const Connections<L> neighbors = Grid().Neighbors(vertex.index);
+
+        // Consider the remaining moves, until a neighbor that has not been initialized is found.
+        FlowVertex neighbor{};
+        bool descending = false;
+        while (!descending && moveIndex < L) {
+            const Move<L> move = Neighborhood<L>::Moves()[moveIndex++];
             if (neighbors.IsConnected(move)) {
-                // Obtain the coordinates and g-cost of the current neighbor.
-                const Offset2D neighborCoords = coords + move.Offset();
-                const PathCost neighborGCost = Tree().GCost(neighborCoords);
+                // Obtain the linear index and g-cost of the current neighbor.
+                const int neighborIndex = Grid().NeighborIndex(vertex.coords, vertex.index, move);
+                const PathCost neighborGCost = Tree().GCost(neighborIndex);
 
                 assert(neighborGCost >= gCost - move.Cost());  // It should be impossible for the neighbor to have a g-cost less than the current g-cost minus the move cost.
 
                 // If the neighbor has a g-cost equal to the current g-cost minus the move cost,
-                // then (1) initialize the neighbor and add it the stack if needed, and (2) include
+                // then (1) initialize the neighbor and descend to it if needed, and (2) include
                 // the connection as part of the flow graph representing all shortest grid paths.
                 if (neighborGCost == gCost - move.Cost()) {
-                    if (!IsCountingNodeInitialized(neighborCoords)) {
-                        InitializeCountingNode(neighborCoords);
-                        stack.push_back(neighborCoords);
+                    if (!IsCountingNodeInitialized(neighborIndex)) {
+                        InitializeCountingNode(neighborIndex);
+                        neighbor = { vertex.coords + move.Offset(), neighborIndex };
+                        descending = true;
                     }
-                    predecessors.Connect(move);
-                    successorGraph_[neighborCoords].Connect(-move);
+                    predecessorGraph_[vertex.index].Connect(move);
+                    successorGraph_[neighborIndex].Connect(-move);
                 }
             }
         }
+
+        // Either descend to the new neighbor, or finish the current vertex.
+        if (descending) {
+            stack.push_back({ neighbor, 0 });
+        }
+        else {
+            flowOrder_.push_back(vertex);
+            stack.pop_back();
+        }
     }
 }
 
 template <int L>
-void PathFlow<L>::CountPaths(Array2D<PathCount>& counts, Offset2D sourceCoords, const Array2D<Connections<L>>& successorGraph)
+inline PathCount PathFlow<L>::SumCounts(const TiledArray2D<PathCount>& counts, Offset2D coords, int index, const TiledArray2D<Connections<L>>& predecessorGraph) const
 {
-    // Create a queue to ensure nodes are counted in a viable order.
-    // It is assumed that counting is performed first from sample to source,
-    // and then from source to sample. With this assumption, negating the 
-    // g-costs ensures that any node with the lowest g-cost is one for which
-    // the preceding nodes have already been processed.
-    auto queue = Tree().CreateDijkstraQueue();
-    Tree().SetGCost(sourceCoords, -Tree().GCost(sourceCoords));  // Negate the g-cost.
-
-    // Set the initial count to 1, and push the first node.
-    counts[sourceCoords] = PathCount::UnitCount();
-    queue.Push(sourceCoords);
-
-    // Process the next node in the queue until the counting process is complete.
-    bool counting = true;
-    while (counting) {
-        const std::optional<std::pair<Offset2D, PathCost>> node = queue.Pop();
-        counting = node.has_value();
-        if (counting) {
-            const Offset2D coords = node->first;
-            const PathCount count = counts[coords];
-            const Connections<L> successors = successorGraph[coords];
-            assert(IsCountingNodeInitialized(coords));
-            assert(count > PathCount{});
-            for (const Move<L>& move : Neighborhood<L>::Moves()) {
-                if (successors.IsConnected(move)) {
-                    // Obtain the coordinates of the current successor.
-                    const Offset2D successorCoords = coords + move.Offset();
-
-                    // If the successor has not yet been visited, (1) negate its g-cost,
-                    // (2) transfer the current count to it, and (3) push it onto the queue.
-                    // Otherwise, update its count.
-                    if (counts[successorCoords] == PathCount{}) {
-                        Tree().SetGCost(successorCoords, -Tree().GCost(successorCoords));
-                        assert(Tree().GCost(successorCoords) == Tree().GCost(coords) + move.Cost());
-                        counts[successorCoords] = count;
-                        queue.Push(successorCoords);
-                    }
-                    else {
-                        counts[successorCoords] += count;
-                    }
-                    assert(counts[successorCoords] > PathCount{});
-                }
-            }
-        }
+    assert(IsCountingNodeInitialized(index));
+
+    PathCount count{};
+    const Connections<L> predecessors = predecessorGraph[index];
+    for (const Move<L>& move : predecessors) {
+        // The preceding node should already have been counted.
+        const int predecessorIndex = Grid().NeighborIndex(coords, index, move);
+        assert(counts[predecessorIndex] > PathCount{});
+        count += counts[predecessorIndex];
     }
+    assert(count > PathCount{});
+    return count;
 }
 
 }  // namespace
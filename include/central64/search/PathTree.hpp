@@ -3,8 +3,18 @@
 #define CENTRAL64_PATH_TREE
 
 #include <central64/grid/Grid2D.hpp>
+#include <central64/search/SearchStatistics.hpp>
 #include <optional>
 #include <queue>
+#include <type_traits>
+
+/// Define `CENTRAL64_SPLIT_PATH_TREE` as 1 to store the path tree as a structure of arrays,
+/// with the search IDs and g-costs checked for every successor in one array,
+/// and the h-costs and parent moves in another.
+/// By default all attributes of a node are stored together in a single array.
+#ifndef CENTRAL64_SPLIT_PATH_TREE
+#define CENTRAL64_SPLIT_PATH_TREE 0
+#endif
 
 namespace central64 {
 
@@ -21,10 +31,21 @@ public:
 
     const Grid2D<L>& Grid() const { return *gridPtr_; }  ///< Obtain a const reference to the grid.
 
+    uint64_t SearchID() const { return currentSearchID_; }  ///< Get the ID of the current search, which changes whenever a new search is initialized.
+
     bool IsAllNodesSearch() const;  ///< Check if the current search is an all-nodes (e.g. Dijkstra) search.
+    bool IsMultiSearch() const;     ///< Check if the current search is a multi-source, multi-sample search.
 
     Offset2D SourceCoords() const;  ///< Get the coordinates of the current source vertex, the root of the shortest grid path tree.
     Offset2D SampleCoords() const;  ///< Get the coordinates of the current sample vertex, the other end of the path.
+    PathCost CostCap() const;       ///< Get the highest g-cost of the nodes to be reached by the current search, which is unlimited unless an all-nodes search is capped.
+    bool IsSampleReached() const;   ///< Check whether the current sample has been reached with a g-cost that does not exceed the cost cap.
+
+    const std::vector<Offset2D>& Sources() const { return sources_; }  ///< Get the coordinates of every source vertex of the current search.
+    const std::vector<Offset2D>& Samples() const { return samples_; }  ///< Get the coordinates of every candidate sample vertex of the current search, which is empty for an all-nodes search.
+
+    bool IsSource(Offset2D coords) const;  ///< Check whether coordinates `coords` are those of a source vertex of the current search.
+    PathCost Heuristic(Offset2D coords) const;  ///< Compute the heuristic distance from coordinates `coords` to the nearest sample, or zero for an all-nodes search.
 
     PathCost GCost(Offset2D coords) const;  ///< Get the g-cost of the node at coordinates `coords`, the grid-based distance to the source.
     PathCost HCost(Offset2D coords) const;  ///< Get the h-cost of the node at coordinates `coords`, the heuristic or estimated distance to the sample.
@@ -34,6 +55,20 @@ public:
     void InitializeSearch(Offset2D sourceCoords, Offset2D sampleCoords);  ///< Reset the path tree and begin a new search with the specified source coordinates (`sourceCoords`) and sample coordinates (`sampleCoords`).
     void InitializeAllNodesSearch(Offset2D sourceCoords);                 ///< Reset the path tree and begin a new all-nodes search with the specified source coordinates (`sourceCoords`).
 
+    /// Reset the path tree and begin a new all-nodes search with the specified source coordinates (`sourceCoords`),
+    /// which need only reach the nodes with g-costs that do not exceed the cost cap `costCap`.
+    void InitializeAllNodesSearch(Offset2D sourceCoords, PathCost costCap);
+
+    /// Reset the path tree and begin a new search from every source in `sourceCoords` to the nearest sample in `sampleCoords`.
+    /// The g-cost of each node is then the distance to the nearest source. The search method calls `UpdateNearestSample`
+    /// before each termination test, so that the search terminates once the nearest sample is found.
+    void InitializeMultiSearch(const std::vector<Offset2D>& sourceCoords, const std::vector<Offset2D>& sampleCoords);
+
+    /// If the current search is a multi search, make the sample with the lowest g-cost the current sample, keeping the
+    /// current sample in case of a tie. This takes time proportional to the number of samples, and is called once per
+    /// processed node rather than whenever a g-cost is set, so that the g-cost updates of single-pair searches are unaffected.
+    void UpdateNearestSample();
+
     bool IsSearchNodeInitialized(Offset2D coords) const;  ///< Check whether the node at coordinates `coords` has been initialized for the current search.
 
     void InitializeDijkstraNode(Offset2D coords);   ///< Initialize the node at coordinates `coords` for the current search, without computing the heuristic.
@@ -42,14 +77,26 @@ public:
     void SetGCost(Offset2D coords, PathCost gCost);            ///< Set the g-cost `gCost` of the node at coordinates `coords`.
     void SetParentMove(Offset2D coords, const Move<L>& move);  ///< Set the `move` pointing to the parent of the node at coordinates `coords`.
 
-    std::vector<Offset2D> ExtractRegularPath();   ///< Extract a shortest grid path following the parent moves from the sample vertex to the source vertex.
+    PathCost GCost(int index) const;                                ///< Get the g-cost of the node at linear index `index`, as obtained from the grid.
+    PathCost HCost(int index) const;                                ///< Get the h-cost of the node at linear index `index`, as obtained from the grid.
+    bool IsSearchNodeInitialized(int index) const;                  ///< Check whether the node at linear index `index` has been initialized for the current search.
+    void InitializeHeuristicNode(Offset2D coords, int index);       ///< Initialize the node at coordinates `coords` and linear index `index` for the current search, computing the heuristic if it is not an all-nodes search.
+    void SetGCost(int index, PathCost gCost);                       ///< Set the g-cost `gCost` of the node at linear index `index`.
+    void SetParentMove(int index, const Move<L>& move);             ///< Set the `move` pointing to the parent of the node at linear index `index`.
+
+    std::vector<Offset2D> ExtractRegularPath();   ///< Extract a shortest grid path following the parent moves from the sample vertex to the source vertex. For a multi search, the source reached becomes the current source.
     void SetSampleCoords(Offset2D sampleCoords);  ///< Set the sample coordinates to `sampleCoords`.
+    void SetCostCap(PathCost costCap);            ///< Set the cost cap of the current all-nodes search to `costCap`, so that the search can be continued.
+
+    const SearchStatistics& Statistics() const { return statistics_; }  ///< Get the cumulative search statistics, if statistics counting is enabled.
+    SearchStatistics& Statistics() { return statistics_; }              ///< Obtain a reference to the cumulative search statistics, so that search methods can record them.
 
     class DijkstraQueue;
     class HeuristicQueue;
 
-    DijkstraQueue CreateDijkstraQueue() { return DijkstraQueue{ *this }; }     ///< Create a Dijkstra queue associated with this path tree.
-    HeuristicQueue CreateHeuristicQueue() { return HeuristicQueue{ *this }; }  ///< Create a heuristic queue associated with this path tree.
+    DijkstraQueue CreateDijkstraQueue() { return DijkstraQueue{ *this, statistics_ }; }     ///< Create a Dijkstra queue associated with this path tree.
+    DijkstraQueue CreateDijkstraQueue(SearchStatistics& statistics) { return DijkstraQueue{ *this, statistics }; }  ///< Create a Dijkstra queue associated with this path tree that records its statistics in `statistics`, so that queues used by different threads do not share counters.
+    HeuristicQueue CreateHeuristicQueue() { return HeuristicQueue{ *this, statistics_ }; }  ///< Create a heuristic queue associated with this path tree.
 
 private:
     // Check that the source coordinates are valid.
@@ -57,33 +104,74 @@ private:
     // check that the sample coordinates are valid.
     bool IsSearchCriteriaValid() const;
 
+    // Compute the lowest heuristic distance from coordinates `coords` to any sample of the current multi search.
+    PathCost NearestSampleHeuristic(Offset2D coords) const;
+
+    // The attributes of a node that are read whenever the node is considered as a successor.
+    struct HotNode {
+        uint64_t searchID{ 0 };     // The ID of the search for which the node was last initialized.
+        PathCost gCost{};           // The grid-based distance to the source.
+    };
+
+    // The attributes of a node that are only read or written when the node is initialized or improved.
+    struct ColdNode {
+        PathCost hCost{};           // The heuristic or estimated distance to the sample.
+        int parentMoveIndex{};      // The index of the parent move.
+    };
+
     // A grouping of attributes associated with each node of the path tree.
     // The purpose of this data structure is to improve cache locality by
     // ensuring vertex-specific search information is located in a contiguous
     // block of memory.
     struct TreeNode {
-        uint64_t searchID{ 0 };     // The ID of the search for which the node was last initialized.
-        PathCost gCost{};           // The grid-based distance to the source.
-        PathCost hCost{};           // The heuristic or estimated distance to the sample.
-        int parentMoveIndex{};      // The index of the parent move.
+        HotNode hot{};
+        ColdNode cold{};
     };
 
+    static constexpr bool splitNodes = (CENTRAL64_SPLIT_PATH_TREE != 0);  // Whether the hot and cold attributes are stored in separate arrays.
+
+    // Access the hot or cold attributes of the node at coordinates `coords`.
+    HotNode& Hot(Offset2D coords) { return Hot(nodes_.Index(coords)); }
+    const HotNode& Hot(Offset2D coords) const { return Hot(nodes_.Index(coords)); }
+    ColdNode& Cold(Offset2D coords) { return Cold(nodes_.Index(coords)); }
+    const ColdNode& Cold(Offset2D coords) const { return Cold(nodes_.Index(coords)); }
+
+    // Access the hot or cold attributes of the node at linear index `index`.
+    HotNode& Hot(int index);
+    const HotNode& Hot(int index) const;
+    ColdNode& Cold(int index);
+    const ColdNode& Cold(int index) const;
+
     const Grid2D<L>* gridPtr_;
-    Array2D<TreeNode> nodes_;
+    TiledArray2D<std::conditional_t<splitNodes, HotNode, TreeNode>> nodes_;  // The hot attributes, or all attributes if the nodes are not split.
+    TiledArray2D<ColdNode> coldNodes_;                                       // The cold attributes if the nodes are split; otherwise empty.
     uint64_t currentSearchID_;
     Offset2D sourceCoords_;
     Offset2D sampleCoords_;
+    PathCost costCap_;
     bool allNodes_;
+    bool multiSearch_;
+    std::vector<Offset2D> sources_;
+    std::vector<Offset2D> samples_;
+    TiledArray2D<uint64_t> sourceIDs_;  // The ID of the multi search for which each node was last a source, allocated by the first multi search.
+    SearchStatistics statistics_;
 };
 
 template <int L>
 PathTree<L>::PathTree(const Grid2D<L>& grid)
     : gridPtr_{ &grid }
     , nodes_{ grid.Dims() }
+    , coldNodes_{ splitNodes ? grid.Dims() : Offset2D{ 0, 0 } }
     , currentSearchID_{ 0 }
     , sourceCoords_{ InvalidCoords() }
     , sampleCoords_{ InvalidCoords() }
+    , costCap_{ PathCost::MaxCost() }
     , allNodes_{ false }
+    , multiSearch_{ false }
+    , sources_{}
+    , samples_{}
+    , sourceIDs_{}
+    , statistics_{}
 {
 }
 
@@ -95,6 +183,14 @@ inline bool PathTree<L>::IsAllNodesSearch() const
     return allNodes_;
 }
 
+template <int L>
+inline bool PathTree<L>::IsMultiSearch() const
+{
+    assert(IsSearchCriteriaValid());
+
+    return multiSearch_;
+}
+
 template <int L>
 inline Offset2D PathTree<L>::SourceCoords() const
 {
@@ -111,13 +207,48 @@ inline Offset2D PathTree<L>::SampleCoords() const
     return sampleCoords_;
 }
 
+template <int L>
+inline PathCost PathTree<L>::CostCap() const
+{
+    assert(IsSearchCriteriaValid());
+
+    return costCap_;
+}
+
+template <int L>
+inline bool PathTree<L>::IsSampleReached() const
+{
+    assert(IsSearchCriteriaValid());
+
+    const PathCost sampleCost = GCost(SampleCoords());
+    return sampleCost < PathCost::MaxCost() && sampleCost <= costCap_;
+}
+
+template <int L>
+inline bool PathTree<L>::IsSource(Offset2D coords) const
+{
+    assert(IsSearchCriteriaValid());
+
+    return multiSearch_ ? sourceIDs_[coords] == currentSearchID_ : coords == sourceCoords_;
+}
+
+template <int L>
+inline PathCost PathTree<L>::Heuristic(Offset2D coords) const
+{
+    assert(IsSearchCriteriaValid());
+
+    return allNodes_ ? PathCost(0) :
+        multiSearch_ ? NearestSampleHeuristic(coords) :
+                       Neighborhood<L>::StandardCost(sampleCoords_ - coords);
+}
+
 template <int L>
 inline PathCost PathTree<L>::GCost(Offset2D coords) const
 {
     assert(IsSearchCriteriaValid());
 
     // If the node has not been initialized, the recorded g-cost is considered invalid and ignored.
-    return IsSearchNodeInitialized(coords) ? nodes_[coords].gCost : PathCost::MaxCost();
+    return IsSearchNodeInitialized(coords) ? Hot(coords).gCost : PathCost::MaxCost();
 }
 
 template <int L>
@@ -126,7 +257,7 @@ inline PathCost PathTree<L>::HCost(Offset2D coords) const
     assert(IsSearchCriteriaValid());
 
     // If the node has not been initialized, the recorded h-cost is considered invalid and ignored.
-    return IsSearchNodeInitialized(coords) ? nodes_[coords].hCost : PathCost::MaxCost();
+    return IsSearchNodeInitialized(coords) ? Cold(coords).hCost : PathCost::MaxCost();
 }
 
 template <int L>
@@ -135,7 +266,7 @@ inline Move<L> PathTree<L>::ParentMove(Offset2D coords) const
     assert(IsSearchCriteriaValid());
     assert(IsSearchNodeInitialized(coords));
 
-    return Neighborhood<L>::Moves()[nodes_[coords].parentMoveIndex];
+    return Neighborhood<L>::Moves()[Cold(coords).parentMoveIndex];
 }
 
 template <int L>
@@ -147,18 +278,77 @@ inline void PathTree<L>::InitializeSearch(Offset2D sourceCoords, Offset2D sample
     ++currentSearchID_;
     sourceCoords_ = sourceCoords;
     sampleCoords_ = sampleCoords;
+    costCap_ = PathCost::MaxCost();
     allNodes_ = false;
+    multiSearch_ = false;
+    sources_.assign(1, sourceCoords);
+    samples_.assign(1, sampleCoords);
 }
 
 template <int L>
 inline void PathTree<L>::InitializeAllNodesSearch(Offset2D sourceCoords)
+{
+    InitializeAllNodesSearch(sourceCoords, PathCost::MaxCost());
+}
+
+template <int L>
+inline void PathTree<L>::InitializeAllNodesSearch(Offset2D sourceCoords, PathCost costCap)
 {
     assert(Grid().Contains(sourceCoords));
 
     ++currentSearchID_;
     sourceCoords_ = sourceCoords;
     sampleCoords_ = InvalidCoords();
+    costCap_ = costCap;
     allNodes_ = true;
+    multiSearch_ = false;
+    sources_.assign(1, sourceCoords);
+    samples_.clear();
+}
+
+template <int L>
+void PathTree<L>::InitializeMultiSearch(const std::vector<Offset2D>& sourceCoords, const std::vector<Offset2D>& sampleCoords)
+{
+    assert(!sourceCoords.empty());
+    assert(!sampleCoords.empty());
+
+    ++currentSearchID_;
+    sourceCoords_ = sourceCoords.front();
+    sampleCoords_ = sampleCoords.front();
+    costCap_ = PathCost::MaxCost();
+    allNodes_ = false;
+    multiSearch_ = true;
+    sources_ = sourceCoords;
+    samples_ = sampleCoords;
+
+    // Mark the sources with the current search ID.
+    if (sourceIDs_.Dims() != Grid().Dims()) {
+        sourceIDs_ = TiledArray2D<uint64_t>{ Grid().Dims(), 0 };
+    }
+    for (const Offset2D& coords : sources_) {
+        assert(Grid().Contains(coords));
+        sourceIDs_[coords] = currentSearchID_;
+    }
+    for (const Offset2D& coords : samples_) {
+        assert(Grid().Contains(coords));
+    }
+}
+
+template <int L>
+void PathTree<L>::UpdateNearestSample()
+{
+    assert(IsSearchCriteriaValid());
+
+    if (multiSearch_) {
+        PathCost sampleCost = GCost(sampleCoords_);
+        for (const Offset2D& coords : samples_) {
+            const PathCost gCost = GCost(coords);
+            if (gCost < sampleCost) {
+                sampleCoords_ = coords;
+                sampleCost = gCost;
+            }
+        }
+    }
 }
 
 template <int L>
@@ -166,7 +356,7 @@ inline bool PathTree<L>::IsSearchNodeInitialized(Offset2D coords) const
 {
     assert(IsSearchCriteriaValid());
 
-    return nodes_[coords].searchID == currentSearchID_;
+    return Hot(coords).searchID == currentSearchID_;
 }
 
 template <int L>
@@ -174,10 +364,10 @@ inline void PathTree<L>::InitializeDijkstraNode(Offset2D coords)
 {
     assert(IsSearchCriteriaValid());
 
-    TreeNode& node = nodes_[coords];
-    node.searchID = currentSearchID_;
-    node.gCost = PathCost::MaxCost();
-    node.hCost = PathCost::MaxCost();
+    HotNode& hotNode = Hot(coords);
+    hotNode.searchID = currentSearchID_;
+    hotNode.gCost = PathCost::MaxCost();
+    Cold(coords).hCost = PathCost::MaxCost();
 }
 
 template <int L>
@@ -185,10 +375,10 @@ inline void PathTree<L>::InitializeHeuristicNode(Offset2D coords)
 {
     assert(IsSearchCriteriaValid());
 
-    TreeNode& node = nodes_[coords];
-    node.searchID = currentSearchID_;
-    node.gCost = PathCost::MaxCost();
-    node.hCost = allNodes_ ? PathCost(0) : Neighborhood<L>::StandardCost(SampleCoords() - coords);
+    HotNode& hotNode = Hot(coords);
+    hotNode.searchID = currentSearchID_;
+    hotNode.gCost = PathCost::MaxCost();
+    Cold(coords).hCost = Heuristic(coords);
 }
 
 template <int L>
@@ -197,7 +387,7 @@ inline void PathTree<L>::SetGCost(Offset2D coords, PathCost gCost)
     assert(IsSearchCriteriaValid());
     assert(IsSearchNodeInitialized(coords));
 
-    nodes_[coords].gCost = gCost;
+    Hot(coords).gCost = gCost;
 }
 
 template <int L>
@@ -206,7 +396,63 @@ inline void PathTree<L>::SetParentMove(Offset2D coords, const Move<L>& move)
     assert(IsSearchCriteriaValid());
     assert(IsSearchNodeInitialized(coords));
 
-    nodes_[coords].parentMoveIndex = move.Index();
+    Cold(coords).parentMoveIndex = move.Index();
+}
+
+template <int L>
+inline PathCost PathTree<L>::GCost(int index) const
+{
+    assert(IsSearchCriteriaValid());
+
+    // If the node has not been initialized, the recorded g-cost is considered invalid and ignored.
+    return IsSearchNodeInitialized(index) ? Hot(index).gCost : PathCost::MaxCost();
+}
+
+template <int L>
+inline PathCost PathTree<L>::HCost(int index) const
+{
+    assert(IsSearchCriteriaValid());
+
+    // If the node has not been initialized, the recorded h-cost is considered invalid and ignored.
+    return IsSearchNodeInitialized(index) ? Cold(index).hCost : PathCost::MaxCost();
+}
+
+template <int L>
+inline bool PathTree<L>::IsSearchNodeInitialized(int index) const
+{
+    assert(IsSearchCriteriaValid());
+
+    return Hot(index).searchID == currentSearchID_;
+}
+
+template <int L>
+inline void PathTree<L>::InitializeHeuristicNode(Offset2D coords, int index)
+{
+    assert(IsSearchCriteriaValid());
+    assert(Grid().Index(coords) == index);
+
+    HotNode& hotNode = Hot(index);
+    hotNode.searchID = currentSearchID_;
+    hotNode.gCost = PathCost::MaxCost();
+    Cold(index).hCost = Heuristic(coords);
+}
+
+template <int L>
+inline void PathTree<L>::SetGCost(int index, PathCost gCost)
+{
+    assert(IsSearchCriteriaValid());
+    assert(IsSearchNodeInitialized(index));
+
+    Hot(index).gCost = gCost;
+}
+
+template <int L>
+inline void PathTree<L>::SetParentMove(int index, const Move<L>& move)
+{
+    assert(IsSearchCriteriaValid());
+    assert(IsSearchNodeInitialized(index));
+
+    Cold(index).parentMoveIndex = move.Index();
 }
 
 template <int L>
@@ -216,9 +462,9 @@ std::vector<Offset2D> PathTree<L>::ExtractRegularPath()
 
     std::vector<Offset2D> pathVertices{};
     if (Grid().Contains(SampleCoords())) {
-        if (GCost(SampleCoords()) < PathCost::MaxCost()) {
+        if (IsSampleReached()) {
             Offset2D coords = SampleCoords();
-            while (coords != SourceCoords()) {
+            while (!IsSource(coords)) {
                 pathVertices.push_back(coords);
                 const Offset2D nextCoords = coords + ParentMove(coords).Offset();
                 assert(Grid().Contains(nextCoords));
@@ -227,6 +473,7 @@ std::vector<Offset2D> PathTree<L>::ExtractRegularPath()
                 coords = nextCoords;
             }
             pathVertices.push_back(coords);
+            sourceCoords_ = coords;
         }
     }
     return pathVertices;
@@ -236,8 +483,20 @@ template <int L>
 void PathTree<L>::SetSampleCoords(Offset2D sampleCoords)
 {
     assert(Grid().Contains(sampleCoords));
+    assert(!multiSearch_);
 
     sampleCoords_ = sampleCoords;
+    if (!allNodes_) {
+        samples_.assign(1, sampleCoords);
+    }
+}
+
+template <int L>
+void PathTree<L>::SetCostCap(PathCost costCap)
+{
+    assert(allNodes_);
+
+    costCap_ = costCap;
 }
 
 template <int L>
@@ -246,6 +505,61 @@ inline bool PathTree<L>::IsSearchCriteriaValid() const
     return Grid().Contains(sourceCoords_) && (Grid().Contains(sampleCoords_) || allNodes_);
 }
 
+template <int L>
+PathCost PathTree<L>::NearestSampleHeuristic(Offset2D coords) const
+{
+    // Take the lowest heuristic distance to any sample, which remains admissible and consistent.
+    PathCost hCost = PathCost::MaxCost();
+    for (const Offset2D& sampleCoords : samples_) {
+        hCost = std::min(hCost, Neighborhood<L>::StandardCost(sampleCoords - coords));
+    }
+    return hCost;
+}
+
+template <int L>
+inline typename PathTree<L>::HotNode& PathTree<L>::Hot(int index)
+{
+    if constexpr (splitNodes) {
+        return nodes_[index];
+    }
+    else {
+        return nodes_[index].hot;
+    }
+}
+
+template <int L>
+inline const typename PathTree<L>::HotNode& PathTree<L>::Hot(int index) const
+{
+    if constexpr (splitNodes) {
+        return nodes_[index];
+    }
+    else {
+        return nodes_[index].hot;
+    }
+}
+
+template <int L>
+inline typename PathTree<L>::ColdNode& PathTree<L>::Cold(int index)
+{
+    if constexpr (splitNodes) {
+        return coldNodes_[index];
+    }
+    else {
+        return nodes_[index].cold;
+    }
+}
+
+template <int L>
+inline const typename PathTree<L>::ColdNode& PathTree<L>::Cold(int index) const
+{
+    if constexpr (splitNodes) {
+        return coldNodes_[index];
+    }
+    else {
+        return nodes_[index].cold;
+    }
+}
+
 /// A priority queue for which nodes are sorted by g-cost.
 /// The same node may be pushed multiple times during the same search,
 /// but the g-cost is assumed to decrease with each push.
@@ -257,6 +571,7 @@ class PathTree<L>::DijkstraQueue
 public:
     std::optional<std::pair<Offset2D, PathCost>> Pop();  ///< Pop the node with the lowest g-cost, and return the coordinates and g-cost.
     void Push(Offset2D coords);                          ///< Push a node with coordinates `coords` onto the queue, looking up its g-cost in the path tree.
+    void Push(Offset2D coords, int index);               ///< Push a node with coordinates `coords` and linear index `index` onto the queue, looking up its g-cost in the path tree.
 
 private:
     struct QueueNode {
@@ -268,11 +583,12 @@ private:
         bool operator()(const QueueNode& lhs, const QueueNode& rhs) const { return lhs.gCost > rhs.gCost; }
     };
 
-    explicit DijkstraQueue(const PathTree<L>& pathTree) : pathTreePtr_{ &pathTree } {};
+    explicit DijkstraQueue(const PathTree<L>& pathTree, SearchStatistics& statistics) : pathTreePtr_{ &pathTree }, statisticsPtr_{ &statistics } {};
 
     std::priority_queue<QueueNode, std::vector<QueueNode>, LowerPriority> queue_{};
 
     const PathTree<L>* pathTreePtr_;
+    SearchStatistics* statisticsPtr_;
 };
 
 /// A priority queue for which nodes are sorted by f-cost, the sum of the g-cost and h-cost.
@@ -284,8 +600,10 @@ class PathTree<L>::HeuristicQueue
     friend class PathTree<L>;
 
 public:
-    std::optional<std::pair<Offset2D, PathCost>> Pop();  ///< Pop the node with the lowest f-cost, and return the coordinates and f-cost.
-    void Push(Offset2D coords);                          ///< Push a node with coordinates `coords` onto the queue, looking up its g-cost and h-cost in the path tree.
+    std::optional<std::pair<Offset2D, PathCost>> Pop();   ///< Pop the node with the lowest f-cost, and return the coordinates and f-cost.
+    std::optional<std::pair<Offset2D, PathCost>> Peek();  ///< Return the coordinates and f-cost of the node with the lowest f-cost, without popping it.
+    void Push(Offset2D coords);                           ///< Push a node with coordinates `coords` onto the queue, looking up its g-cost and h-cost in the path tree.
+    void Push(Offset2D coords, int index);                ///< Push a node with coordinates `coords` and linear index `index` onto the queue, looking up its g-cost and h-cost in the path tree.
 
 private:
     struct QueueNode {
@@ -298,11 +616,12 @@ private:
         bool operator()(const QueueNode& lhs, const QueueNode& rhs) const { return lhs.fCost > rhs.fCost; }
     };
 
-    explicit HeuristicQueue(const PathTree<L>& pathTree) : pathTreePtr_{ &pathTree } {};
+    explicit HeuristicQueue(const PathTree<L>& pathTree, SearchStatistics& statistics) : pathTreePtr_{ &pathTree }, statisticsPtr_{ &statistics } {};
 
     std::priority_queue<QueueNode, std::vector<QueueNode>, LowerPriority> queue_{};
 
     const PathTree<L>* pathTreePtr_;
+    SearchStatistics* statisticsPtr_;
 };
 
 template <int L>
@@ -312,8 +631,9 @@ inline std::optional<std::pair<Offset2D, PathCost>> PathTree<L>::DijkstraQueue::
 
     // Loop over and discard all nodes for which the g-cost in the internal queue does not match the g-cost in the path tree.
     // It is assumed that such an entry exists in the internal queue because the node was subsequently pushed with a lower g-cost.
-    while (!queue_.empty() ? queue_.top().gCost != pathTreePtr_->nodes_[queue_.top().coords].gCost : false) {
-        assert(pathTreePtr_->nodes_[queue_.top().coords].gCost < queue_.top().gCost);  // Ensure the g-cost was not increased.
+    while (!queue_.empty() ? queue_.top().gCost != pathTreePtr_->Hot(queue_.top().coords).gCost : false) {
+        assert(pathTreePtr_->Hot(queue_.top().coords).gCost < queue_.top().gCost);  // Ensure the g-cost was not increased.
+        CountStatistic(statisticsPtr_->stalePops);
         queue_.pop();
     }
 
@@ -328,26 +648,46 @@ inline std::optional<std::pair<Offset2D, PathCost>> PathTree<L>::DijkstraQueue::
 template <int L>
 inline void PathTree<L>::DijkstraQueue::Push(Offset2D coords)
 {
-    const PathCost gCost = pathTreePtr_->nodes_[coords].gCost;
+    Push(coords, pathTreePtr_->Grid().Index(coords));
+}
+
+template <int L>
+inline void PathTree<L>::DijkstraQueue::Push(Offset2D coords, int index)
+{
+    assert(pathTreePtr_->Grid().Index(coords) == index);
+
+    const PathCost gCost = pathTreePtr_->Hot(index).gCost;
+    CountStatistic(statisticsPtr_->pushes);
     queue_.push({ coords, gCost });
 }
 
 template <int L>
 inline std::optional<std::pair<Offset2D, PathCost>> PathTree<L>::HeuristicQueue::Pop()
+{
+    // Find the top entry with a valid g-cost, and then remove it from the internal queue.
+    const std::optional<std::pair<Offset2D, PathCost>> node = Peek();
+    if (node.has_value()) {
+        queue_.pop();
+    }
+    return node;
+}
+
+template <int L>
+inline std::optional<std::pair<Offset2D, PathCost>> PathTree<L>::HeuristicQueue::Peek()
 {
     std::optional<std::pair<Offset2D, PathCost>> node{};
 
     // Loop over and discard all nodes for which the g-cost in the internal queue does not match the g-cost in the path tree.
     // It is assumed that such an entry exists in the internal queue because the node was subsequently pushed with a lower g-cost.
-    while (!queue_.empty() ? queue_.top().gCost != pathTreePtr_->nodes_[queue_.top().coords].gCost : false) {
-        assert(pathTreePtr_->nodes_[queue_.top().coords].gCost < queue_.top().gCost);  // Ensure the g-cost was not increased.
+    while (!queue_.empty() ? queue_.top().gCost != pathTreePtr_->Hot(queue_.top().coords).gCost : false) {
+        assert(pathTreePtr_->Hot(queue_.top().coords).gCost < queue_.top().gCost);  // Ensure the g-cost was not increased.
+        CountStatistic(statisticsPtr_->stalePops);
         queue_.pop();
     }
 
-    // Pop and return the top entry in the internal queue, which is now guaranteed to have a g-cost that matches the one in the path tree.
+    // Return the top entry in the internal queue, which is now guaranteed to have a g-cost that matches the one in the path tree.
     if (!queue_.empty()) {
         node = { queue_.top().coords, queue_.top().fCost };
-        queue_.pop();
     }
     return node;
 }
@@ -355,10 +695,19 @@ inline std::optional<std::pair<Offset2D, PathCost>> PathTree<L>::HeuristicQueue:
 template <int L>
 inline void PathTree<L>::HeuristicQueue::Push(Offset2D coords)
 {
-    const PathCost gCost = pathTreePtr_->nodes_[coords].gCost;
-    const PathCost hCost = pathTreePtr_->nodes_[coords].hCost;
+    Push(coords, pathTreePtr_->Grid().Index(coords));
+}
+
+template <int L>
+inline void PathTree<L>::HeuristicQueue::Push(Offset2D coords, int index)
+{
+    assert(pathTreePtr_->Grid().Index(coords) == index);
+
+    const PathCost gCost = pathTreePtr_->Hot(index).gCost;
+    const PathCost hCost = pathTreePtr_->Cold(index).hCost;
     assert(gCost != PathCost::MaxCost());
     assert(hCost != PathCost::MaxCost());
+    CountStatistic(statisticsPtr_->pushes);
     queue_.push({ coords, gCost, gCost + hCost });
 }
 
@@ -0,0 +1,74 @@
+#pragma once
+#ifndef CENTRAL64_RELAXATION
+#define CENTRAL64_RELAXATION
+
+#include <central64/grid/Neighborhood.hpp>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace central64 {
+
+/// A kernel that relaxes all successors of a search node at once, in the `L`-neighbor grid.
+/// If the code is compiled with AVX2 enabled (e.g. `-mavx2`), the g-costs of 4 successors are compared per instruction.
+/// Otherwise a scalar loop is used, which the compiler may vectorize with whatever instructions are available.
+template <int L>
+class Relaxation
+{
+public:
+    /// Obtain a set of bits indicating which successors are improved by a path through a node with g-cost `gCost`.
+    /// Bit `i` is set if `gCost` plus the cost of move `i` is less than `successorGCosts[i]`.
+    /// Moves to successors that are not to be relaxed should be given a g-cost of zero, which can never be improved.
+    static uint64_t ImprovedMoves(PathCost gCost, const std::array<PathCost, L>& successorGCosts);
+
+private:
+    Relaxation() = delete;
+
+    // Compute the array of move costs, indexed by move.
+    static constexpr std::array<PathCost, L> ComputeMoveCosts();
+
+    alignas(32) static constexpr std::array<PathCost, L> moveCosts = ComputeMoveCosts();  // The cost of each move.
+};
+
+template <int L>
+inline uint64_t Relaxation<L>::ImprovedMoves(PathCost gCost, const std::array<PathCost, L>& successorGCosts)
+{
+    uint64_t improvedMoves = 0;
+#if defined(__AVX2__)
+    static_assert(sizeof(PathCost) == sizeof(int64_t) && std::is_trivially_copyable_v<PathCost>, "Path costs must be stored as 64-bit integers.");
+
+    // Broadcast the g-cost, then add the move costs and compare with the successor g-costs 4 moves at a time.
+    // Path costs of finite paths are far below the saturation limit, so the sums do not need to be saturated.
+    int64_t gCostMultiplier;
+    std::memcpy(&gCostMultiplier, &gCost, sizeof(int64_t));
+    const __m256i gCosts = _mm256_set1_epi64x(gCostMultiplier);
+    for (int i = 0; i < L; i += 4) {
+        const __m256i viaCosts = _mm256_add_epi64(gCosts, _mm256_load_si256(reinterpret_cast<const __m256i*>(&moveCosts[i])));
+        const __m256i oldCosts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&successorGCosts[i]));
+        const __m256i improved = _mm256_cmpgt_epi64(oldCosts, viaCosts);
+        improvedMoves |= uint64_t(_mm256_movemask_pd(_mm256_castsi256_pd(improved))) << i;
+    }
+#else
+    for (int i = 0; i < L; ++i) {
+        improvedMoves |= uint64_t(gCost + moveCosts[i] < successorGCosts[i]) << i;
+    }
+#endif
+    return improvedMoves;
+}
+
+template <int L>
+constexpr std::array<PathCost, L> Relaxation<L>::ComputeMoveCosts()
+{
+    std::array<PathCost, L> moveCosts{};
+    for (const Move<L>& move : Neighborhood<L>::Moves()) {
+        moveCosts[move.Index()] = move.Cost();
+    }
+    return moveCosts;
+}
+
+}  // namespace
+
+#endif
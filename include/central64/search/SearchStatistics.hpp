@@ -0,0 +1,48 @@
+#pragma once
+#ifndef CENTRAL64_SEARCH_STATISTICS
+#define CENTRAL64_SEARCH_STATISTICS
+
+#include <central64/grid/Types.hpp>
+
+/// Define `CENTRAL64_COUNT_STATISTICS` as 1 to count the operations performed by search and smoothing methods.
+/// By default the counting code is compiled out, and all recorded statistics remain zero.
+#ifndef CENTRAL64_COUNT_STATISTICS
+#define CENTRAL64_COUNT_STATISTICS 0
+#endif
+
+namespace central64 {
+
+/// The cumulative number of operations performed by search and smoothing methods.
+struct SearchStatistics
+{
+    uint64_t expansions{ 0 };         ///< The number of nodes expanded, each of which considers a set of successors.
+    uint64_t pushes{ 0 };             ///< The number of entries pushed onto priority queues.
+    uint64_t stalePops{ 0 };          ///< The number of outdated queue entries discarded when popping a priority queue.
+    uint64_t jumpCells{ 0 };          ///< The number of cells scanned during jump traversals.
+    uint64_t lineOfSightChecks{ 0 };  ///< The number of line-of-sight checks performed during smoothing.
+
+    static constexpr bool enabled = (CENTRAL64_COUNT_STATISTICS != 0);  ///< Check whether statistics counting is compiled in.
+
+    /// Add the counts of `other` to these counts.
+    SearchStatistics& operator+=(const SearchStatistics& other)
+    {
+        expansions += other.expansions;
+        pushes += other.pushes;
+        stalePops += other.stalePops;
+        jumpCells += other.jumpCells;
+        lineOfSightChecks += other.lineOfSightChecks;
+        return *this;
+    }
+};
+
+/// Add `count` to the statistics `counter` if statistics counting is enabled; otherwise do nothing.
+inline void CountStatistic(uint64_t& counter, uint64_t count = 1)
+{
+    if constexpr (SearchStatistics::enabled) {
+        counter += count;
+    }
+}
+
+}  // namespace
+
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+#ifndef CENTRAL64_STAGE_TIMES
+#define CENTRAL64_STAGE_TIMES
+
+#include <central64/grid/Types.hpp>
+#include <chrono>
+
+/// Define `CENTRAL64_STAGE_TIMING` as 1 to record the time spent in each stage of path planning.
+/// By default the timing code is compiled out, and all recorded stage times remain zero.
+#ifndef CENTRAL64_STAGE_TIMING
+#define CENTRAL64_STAGE_TIMING 0
+#endif
+
+namespace central64 {
+
+/// The cumulative time, in nanoseconds, spent in each stage of path planning.
+struct StageTimes
+{
+    int64_t search{ 0 };             ///< The time spent performing path searches.
+    int64_t centralExtraction{ 0 };  ///< The time spent extracting central grid paths using the path flow object.
+    int64_t regularExtraction{ 0 };  ///< The time spent extracting regular grid paths using the path tree object.
+    int64_t smoothing{ 0 };          ///< The time spent smoothing paths.
+
+    static constexpr bool enabled = (CENTRAL64_STAGE_TIMING != 0);  ///< Check whether stage timing is compiled in.
+};
+
+/// A scoped timer that adds the time elapsed during its lifetime to a stage time, if stage timing is enabled.
+class StageTimer
+{
+public:
+#if CENTRAL64_STAGE_TIMING
+    explicit StageTimer(int64_t& stageTime) : stageTime_{ stageTime }, start_{ std::chrono::steady_clock::now() } {}  ///< Start timing a stage, to be added to `stageTime`.
+    ~StageTimer() { stageTime_ += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count(); }  ///< Stop timing the stage.
+#else
+    explicit StageTimer(int64_t&) {}  ///< Do nothing, since stage timing is disabled.
+#endif
+
+private:
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+#if CENTRAL64_STAGE_TIMING
+    int64_t& stageTime_;
+    std::chrono::steady_clock::time_point start_;
+#endif
+};
+
+}  // namespace
+
+#endif
@@ -0,0 +1,488 @@
+#pragma once
+#ifndef CENTRAL64_SUBGOAL_GRAPH_SEARCH
+#define CENTRAL64_SUBGOAL_GRAPH_SEARCH
+
+#include <central64/search/BasicSearch.hpp>
+#include <central64/search/TautPathRefinement.hpp>
+
+namespace central64 {
+
+/// A derived class for the `L`-neighbor subgoal graph search method, which supports the 8- and 16-neighborhoods.
+/// When the object is created, the grid is preprocessed into a graph of subgoals, the vertices at which a jump
+/// traversal can encounter forced successors. Two subgoals are connected if a taut path joins them, meaning a grid
+/// path whose cost equals the standard cost between its endpoints, without passing through any other subgoal.
+/// Each query connects the source and sample to their nearby subgoals in the same way, and searches the graph.
+/// Each edge of the path found is then refined by assigning g-costs to the vertices of all taut paths between its
+/// endpoints, so that regular and central grid paths are extracted from the path tree and path flow as usual.
+/// Central grid paths are therefore central among the shortest grid paths through the subgoals found.
+/// The graph is intended for static maps. An update of the grid is only recorded, and the next point-to-point search
+/// repairs the graph, reconnecting only the subgoals whose taut paths may pass through a vertex whose connections changed.
+/// All-nodes and multi searches do not use the graph, and are performed as Dijkstra and A* searches.
+template <int L>
+class SubgoalGraphSearch : public BasicSearch<L>
+{
+    static_assert(L == 8 || L == 16, "Subgoal graph search requires a neighborhood size of 8 or 16.");
+
+public:
+    explicit SubgoalGraphSearch(const Grid2D<L>& grid);  ///< Create a subgoal graph search object that references an existing grid object, and build the subgoal graph.
+
+    SubgoalGraphSearch(SubgoalGraphSearch&&) = default;             ///< Ensure the default move constructor is public.
+    SubgoalGraphSearch& operator=(SubgoalGraphSearch&&) = default;  ///< Ensure the default move assignment operator is public.
+
+    std::string MethodName() const { return "Subgoal Graph Search"; }     ///< Get the name of the search method.
+    std::string AllNodesMethodName() const { return "Dijkstra Search"; }  ///< Get the name of the all-nodes version of the search method, which does not use the subgoal graph.
+
+    const std::vector<Offset2D>& Subgoals() const { return subgoals_; }  ///< Get the coordinates of every subgoal, as of the last point-to-point search if the grid has been updated since.
+    int EdgeCount() const { return int(edges_.size()); }                ///< Get the number of directed edges in the subgoal graph, as of the last point-to-point search if the grid has been updated since.
+
+    const Grid2D<L>& Grid() const { return BasicSearch<L>::Grid(); }
+    bool IsAllNodesSearch() const { return BasicSearch<L>::IsAllNodesSearch(); }
+    Offset2D SourceCoords() const { return BasicSearch<L>::SourceCoords(); }
+    Offset2D SampleCoords() const { return BasicSearch<L>::SampleCoords(); }
+    bool Centralize() const { return BasicSearch<L>::Centralize(); }
+    bool FromSource() const { return BasicSearch<L>::FromSource(); }
+    PathTree<L>& Tree() const { return BasicSearch<L>::Tree(); }
+    PathFlow<L>& Flow() const { return BasicSearch<L>::Flow(); }
+
+private:
+    // An edge of the subgoal graph, or a connection between the source or sample and a subgoal.
+    struct SubgoalEdge {
+        int nodeIndex;  // The index of the subgoal at the other end of the edge.
+        PathCost cost;  // The cost of a taut path between the endpoints.
+    };
+
+    // The attributes of a subgoal, or of the source or sample, during a query.
+    struct SubgoalNode {
+        uint64_t queryID{ 0 };  // The ID of the query for which the node was last initialized.
+        PathCost gCost{};       // The cost of the shortest path found from the source.
+        PathCost sampleCost{};  // The cost of a taut path to the sample, or the maximum cost if the sample is not directly connected.
+        int parentIndex{ -1 };  // The index of the preceding node on the shortest path found.
+    };
+
+    struct QueueNode {
+        int nodeIndex;
+        PathCost gCost;
+        PathCost fCost;
+    };
+
+    struct LowerPriority {
+        bool operator()(const QueueNode& lhs, const QueueNode& rhs) const { return lhs.fCost > rhs.fCost; }
+    };
+
+    // The coordinates and linear index of a vertex visited while following taut paths.
+    struct FloodVertex {
+        Offset2D coords;
+        int index;
+    };
+
+    // Search the subgoal graph if the current search is a point-to-point search. Otherwise perform a basic search.
+    void PerformSearch();
+
+    // Process the node at coordinates `coords` of an all-nodes or multi search, given its f-cost `fCost`.
+    bool ProcessSearchNode(Offset2D coords, PathCost fCost);
+
+    // Record that the connections of the vertices at `changedVertices` have changed, so that the graph is repaired by the next query.
+    void UpdateVertices(const std::vector<Offset2D>& changedVertices);
+
+    // Identify the subgoals and connect each pair that is joined by a taut path through no other subgoal.
+    void BuildSubgoalGraph();
+
+    // Update the subgoals at the changed vertices, and reconnect the subgoals whose taut paths may have changed.
+    // The result is the same as that of rebuilding the graph.
+    void RepairSubgoalGraph();
+
+    // Check whether the vertex at coordinates `coords` has forced successors for any connected parent move.
+    bool IsSubgoal(Offset2D coords) const;
+
+    // Follow every taut path from the vertex at `originCoords` until a subgoal is reached, and return an edge to each
+    // subgoal reached. If the vertex at `sampleCoords` is reached, set `sampleReached` and stop following paths.
+    std::vector<SubgoalEdge> ConnectSubgoals(Offset2D originCoords, Offset2D sampleCoords, bool& sampleReached);
+
+    // Search the subgoal graph from the source to the sample, and return the indices of the nodes
+    // along the shortest path found. If the sample cannot be reached, return an empty vector.
+    std::vector<int> SearchSubgoalGraph();
+
+    // Initialize the node at index `nodeIndex` for the current query, if it has not already been initialized.
+    void InitializeSubgoalNode(int nodeIndex);
+
+    // Relax the `edge` from the node at index `nodeIndex`, pushing the node at the other end if its path is improved.
+    void RelaxEdge(int nodeIndex, const SubgoalEdge& edge);
+
+    // Get the coordinates of the subgoal, source, or sample at node index `nodeIndex`.
+    Offset2D NodeCoords(int nodeIndex) const;
+
+    bool IsSearchNodeInitialized(Offset2D coords) const { return BasicSearch<L>::IsSearchNodeInitialized(coords); }
+    void InitializeDijkstraNode(Offset2D coords) { BasicSearch<L>::InitializeDijkstraNode(coords); }
+    void InitializeHeuristicNode(Offset2D coords) { BasicSearch<L>::InitializeHeuristicNode(coords); }
+    using DijkstraQueue = typename BasicSearch<L>::DijkstraQueue;
+    using HeuristicQueue = typename BasicSearch<L>::HeuristicQueue;
+    DijkstraQueue CreateDijkstraQueue() { return BasicSearch<L>::CreateDijkstraQueue(); }
+    HeuristicQueue CreateHeuristicQueue() { return BasicSearch<L>::CreateHeuristicQueue(); }
+
+    void ExpandSearchNode(Offset2D coords, Connections<L> successors) { BasicSearch<L>::ExpandSearchNode(coords, successors); }
+
+    std::vector<Offset2D> subgoals_;       // The coordinates of each subgoal, in order of node index.
+    TiledArray2D<int> subgoalIndices_;     // The node index of the subgoal at each vertex, or -1 if the vertex is not a subgoal.
+    std::vector<int> edgeOffsets_;         // The index of the first edge of each subgoal, followed by the total number of edges.
+    std::vector<SubgoalEdge> edges_;       // The edges of every subgoal, grouped by subgoal.
+    std::vector<SubgoalNode> nodes_;       // The query attributes of each subgoal, followed by those of the source and sample.
+    std::vector<SubgoalEdge> sourceEdges_; // The edges from the source of the current query, if it is not a subgoal.
+    std::priority_queue<QueueNode, std::vector<QueueNode>, LowerPriority> queue_;
+    uint64_t currentQueryID_;
+    int sourceIndex_;                      // The node index of the source of the current query.
+    int sampleIndex_;                      // The node index of the sample of the current query.
+    TiledArray2D<uint64_t> floodIDs_;      // The ID of the traversal of taut paths in which each vertex was last visited.
+    uint64_t currentFloodID_;
+    std::vector<FloodVertex> floodStack_;  // The vertices whose taut paths are yet to be followed.
+    TautPathRefinement<L> refinement_;     // Refines each edge of the path found into the taut paths between its endpoints.
+    std::vector<Offset2D> changedVertices_;  // The vertices whose connections have changed since the graph was built or repaired.
+};
+
+template <int L>
+SubgoalGraphSearch<L>::SubgoalGraphSearch(const Grid2D<L>& grid)
+    : BasicSearch<L>{ grid }
+    , subgoals_{}
+    , subgoalIndices_{}
+    , edgeOffsets_{}
+    , edges_{}
+    , nodes_{}
+    , sourceEdges_{}
+    , queue_{}
+    , currentQueryID_{ 0 }
+    , sourceIndex_{ -1 }
+    , sampleIndex_{ -1 }
+    , floodIDs_{}
+    , currentFloodID_{ 0 }
+    , floodStack_{}
+    , refinement_{}
+    , changedVertices_{}
+{
+    BuildSubgoalGraph();
+}
+
+template <int L>
+void SubgoalGraphSearch<L>::PerformSearch()
+{
+    if (IsAllNodesSearch() || Tree().IsMultiSearch()) {
+        BasicSearch<L>::PerformSearch();
+    }
+    else {
+        // Initialize the source and sample nodes of the path tree.
+        InitializeHeuristicNode(SourceCoords());
+        Tree().SetGCost(SourceCoords(), PathCost(0));
+        if (!IsSearchNodeInitialized(SampleCoords())) {
+            InitializeHeuristicNode(SampleCoords());
+        }
+
+        // Repair the subgoal graph if the grid has been updated, then search it and refine each edge of the path found into
+        // the taut paths between its endpoints. Every vertex refined lies on a shortest grid path from source to sample,
+        // so its g-cost is exact.
+        if (!changedVertices_.empty()) {
+            RepairSubgoalGraph();
+        }
+        const std::vector<int> nodePath = SearchSubgoalGraph();
+        for (int i = 1; i < int(nodePath.size()); ++i) {
+            refinement_.RefineTautPath(Grid(), Tree(), NodeCoords(nodePath[i - 1]), NodeCoords(nodePath[i]), nodes_[nodePath[i - 1]].gCost);
+        }
+    }
+}
+
+template <int L>
+bool SubgoalGraphSearch<L>::ProcessSearchNode(Offset2D coords, PathCost fCost)
+{
+    // Terminate the search under the same conditions as an A* or Dijkstra search.
+    const bool searching = IsAllNodesSearch() ? (fCost <= Tree().CostCap()) :
+                                                Centralize() ? (fCost <= Tree().GCost(SampleCoords())) :
+                                                               (fCost < Tree().GCost(SampleCoords()));
+
+    // If the search is to continue, expand the current node.
+    if (searching) {
+        ExpandSearchNode(coords, Grid().Neighbors(coords));
+    }
+    return searching;
+}
+
+template <int L>
+void SubgoalGraphSearch<L>::BuildSubgoalGraph()
+{
+    // Identify the subgoals in row-major order.
+    subgoals_.clear();
+    subgoalIndices_ = TiledArray2D<int>{ Grid().Dims(), -1 };
+    for (int y = 0; y < Grid().Dims().Y(); ++y) {
+        for (int x = 0; x < Grid().Dims().X(); ++x) {
+            if (IsSubgoal({ x, y })) {
+                subgoalIndices_[{ x, y }] = int(subgoals_.size());
+                subgoals_.push_back({ x, y });
+            }
+        }
+    }
+
+    // Connect each subgoal to the subgoals it reaches by taut paths. Since a taut path
+    // reversed is also taut, every edge is found from both of its endpoints.
+    floodIDs_ = TiledArray2D<uint64_t>{ Grid().Dims(), 0 };
+    currentFloodID_ = 0;
+    edgeOffsets_.assign(1, 0);
+    edges_.clear();
+    for (const Offset2D& subgoalCoords : subgoals_) {
+        bool sampleReached = false;
+        const std::vector<SubgoalEdge> subgoalEdges = ConnectSubgoals(subgoalCoords, PathTree<L>::InvalidCoords(), sampleReached);
+        edges_.insert(std::end(edges_), std::begin(subgoalEdges), std::end(subgoalEdges));
+        edgeOffsets_.push_back(int(edges_.size()));
+    }
+
+    // Reserve a node for each subgoal, and for a source and sample that are not subgoals.
+    nodes_.assign(subgoals_.size() + 2, SubgoalNode{});
+    currentQueryID_ = 0;
+}
+
+template <int L>
+void SubgoalGraphSearch<L>::UpdateVertices(const std::vector<Offset2D>& changedVertices)
+{
+    changedVertices_.insert(std::end(changedVertices_), std::begin(changedVertices), std::end(changedVertices));
+}
+
+template <int L>
+void SubgoalGraphSearch<L>::RepairSubgoalGraph()
+{
+    // Each changed vertex is processed once. If more vertices have changed than there are subgoals, rebuilding is cheaper.
+    std::sort(std::begin(changedVertices_), std::end(changedVertices_), [](Offset2D lhs, Offset2D rhs) {
+        return (lhs.Y() < rhs.Y()) || (lhs.Y() == rhs.Y() && lhs.X() < rhs.X());
+    });
+    changedVertices_.erase(std::unique(std::begin(changedVertices_), std::end(changedVertices_)), std::end(changedVertices_));
+    if (changedVertices_.size() > subgoals_.size()) {
+        BuildSubgoalGraph();
+        changedVertices_.clear();
+        return;
+    }
+
+    // Since forced successors depend only on the connections of a vertex, only a changed vertex can gain or lose its subgoal.
+    // Keep the previous graph, mark the subgoals at the changed vertices, and then renumber all subgoals in row-major order.
+    const std::vector<Offset2D> previousSubgoals = std::move(subgoals_);
+    const std::vector<int> previousEdgeOffsets = std::move(edgeOffsets_);
+    const std::vector<SubgoalEdge> previousEdges = std::move(edges_);
+    for (const Offset2D& coords : changedVertices_) {
+        subgoalIndices_[coords] = IsSubgoal(coords) ? 0 : -1;
+    }
+    subgoals_.clear();
+    for (int y = 0; y < Grid().Dims().Y(); ++y) {
+        for (int x = 0; x < Grid().Dims().X(); ++x) {
+            if (subgoalIndices_[{ x, y }] >= 0) {
+                subgoalIndices_[{ x, y }] = int(subgoals_.size());
+                subgoals_.push_back({ x, y });
+            }
+        }
+    }
+
+    // A taut path that was added or removed passes through a changed vertex, and the part of the path before the first
+    // changed vertex is unchanged. Since a taut path reversed is also taut, following the taut paths from each changed
+    // vertex reaches every subgoal whose edges may have changed. Subgoals at changed vertices are also reconnected.
+    std::vector<bool> reconnected(subgoals_.size(), false);
+    for (const Offset2D& coords : changedVertices_) {
+        if (subgoalIndices_[coords] >= 0) {
+            reconnected[subgoalIndices_[coords]] = true;
+        }
+        bool sampleReached = false;
+        for (const SubgoalEdge& edge : ConnectSubgoals(coords, PathTree<L>::InvalidCoords(), sampleReached)) {
+            reconnected[edge.nodeIndex] = true;
+        }
+    }
+
+    // Reconnect the affected subgoals, and copy the edges of the others, which lead to the same subgoals as before.
+    edgeOffsets_.assign(1, 0);
+    edges_.clear();
+    for (int nodeIndex = 0; nodeIndex < int(subgoals_.size()); ++nodeIndex) {
+        if (reconnected[nodeIndex]) {
+            bool sampleReached = false;
+            const std::vector<SubgoalEdge> subgoalEdges = ConnectSubgoals(subgoals_[nodeIndex], PathTree<L>::InvalidCoords(), sampleReached);
+            edges_.insert(std::end(edges_), std::begin(subgoalEdges), std::end(subgoalEdges));
+        }
+        else {
+            const int previousIndex = int(std::lower_bound(std::begin(previousSubgoals), std::end(previousSubgoals), subgoals_[nodeIndex],
+                                                           [](Offset2D lhs, Offset2D rhs) {
+                                                               return (lhs.Y() < rhs.Y()) || (lhs.Y() == rhs.Y() && lhs.X() < rhs.X());
+                                                           }) - std::begin(previousSubgoals));
+            assert(previousSubgoals[previousIndex] == subgoals_[nodeIndex]);
+            for (int i = previousEdgeOffsets[previousIndex]; i < previousEdgeOffsets[previousIndex + 1]; ++i) {
+                const int edgeNodeIndex = subgoalIndices_[previousSubgoals[previousEdges[i].nodeIndex]];
+                assert(edgeNodeIndex >= 0);
+                edges_.push_back({ edgeNodeIndex, previousEdges[i].cost });
+            }
+        }
+        edgeOffsets_.push_back(int(edges_.size()));
+    }
+
+    // Reserve a node for each subgoal, and for a source and sample that are not subgoals.
+    nodes_.assign(subgoals_.size() + 2, SubgoalNode{});
+    currentQueryID_ = 0;
+    changedVertices_.clear();
+}
+
+template <int L>
+bool SubgoalGraphSearch<L>::IsSubgoal(Offset2D coords) const
+{
+    // A jump point search only changes direction at a vertex with forced successors, so every
+    // shortest grid path can be divided into taut paths that begin and end at such vertices.
+    bool subgoal = false;
+    for (const Move<L>& parentMove : Grid().Neighbors(coords)) {
+        subgoal = subgoal || !Grid().ForcedSuccessors(coords, parentMove).IsAllDisconnected();
+    }
+    return subgoal;
+}
+
+template <int L>
+std::vector<typename SubgoalGraphSearch<L>::SubgoalEdge> SubgoalGraphSearch<L>::ConnectSubgoals(Offset2D originCoords,
+                                                                                                 Offset2D sampleCoords,
+                                                                                                 bool& sampleReached)
+{
+    // A neighbor continues a taut path if its standard cost from the origin exceeds that of the current vertex
+    // by exactly the cost of the move. Subgoals end the taut paths, so that their own edges continue them.
+    std::vector<SubgoalEdge> subgoalEdges{};
+    const uint64_t floodID = ++currentFloodID_;
+    const FloodVertex origin{ originCoords, Grid().Index(originCoords) };
+    floodIDs_[origin.index] = floodID;
+    floodStack_.assign(1, origin);
+    sampleReached = (originCoords == sampleCoords);
+    while (!floodStack_.empty() && !sampleReached) {
+        const FloodVertex vertex = floodStack_.back();
+        floodStack_.pop_back();
+        CountStatistic(Tree().Statistics().jumpCells);
+        const PathCost cost = Neighborhood<L>::StandardCost(vertex.coords - originCoords);
+        for (const Move<L>& move : Grid().Neighbors(vertex.index)) {
+            const int neighborIndex = Grid().NeighborIndex(vertex.coords, vertex.index, move);
+            if (floodIDs_[neighborIndex] != floodID) {
+                const Offset2D neighborCoords = vertex.coords + move.Offset();
+                const PathCost neighborCost = Neighborhood<L>::StandardCost(neighborCoords - originCoords);
+                if (neighborCost == cost + move.Cost()) {
+                    floodIDs_[neighborIndex] = floodID;
+                    sampleReached = sampleReached || (neighborCoords == sampleCoords);
+                    if (subgoalIndices_[neighborIndex] >= 0) {
+                        subgoalEdges.push_back({ subgoalIndices_[neighborIndex], neighborCost });
+                    }
+                    else {
+                        floodStack_.push_back({ neighborCoords, neighborIndex });
+                    }
+                }
+            }
+        }
+    }
+    return subgoalEdges;
+}
+
+template <int L>
+std::vector<int> SubgoalGraphSearch<L>::SearchSubgoalGraph()
+{
+    ++currentQueryID_;
+    const int subgoalCount = int(subgoals_.size());
+    const int sourceSubgoalIndex = subgoalIndices_[SourceCoords()];
+    const int sampleSubgoalIndex = subgoalIndices_[SampleCoords()];
+    sourceIndex_ = (sourceSubgoalIndex >= 0) ? sourceSubgoalIndex : subgoalCount;
+    sampleIndex_ = (sampleSubgoalIndex >= 0) ? sampleSubgoalIndex : subgoalCount + 1;
+    InitializeSubgoalNode(sourceIndex_);
+    InitializeSubgoalNode(sampleIndex_);
+    nodes_[sourceIndex_].gCost = PathCost(0);
+
+    // Connect a source that is not a subgoal. If the sample is reached directly,
+    // the taut path between them is a shortest path and no search is needed.
+    bool sampleReached = (sourceIndex_ == sampleIndex_);
+    sourceEdges_.clear();
+    if (sourceIndex_ == subgoalCount && !sampleReached) {
+        sourceEdges_ = ConnectSubgoals(SourceCoords(), SampleCoords(), sampleReached);
+        if (sampleReached) {
+            nodes_[sampleIndex_].gCost = Neighborhood<L>::StandardCost(SampleCoords() - SourceCoords());
+            nodes_[sampleIndex_].parentIndex = sourceIndex_;
+        }
+    }
+
+    // Connect a sample that is not a subgoal, recording the cost to the sample on each subgoal reached.
+    if (sampleIndex_ == subgoalCount + 1 && !sampleReached) {
+        bool sourceReached = false;
+        for (const SubgoalEdge& edge : ConnectSubgoals(SampleCoords(), PathTree<L>::InvalidCoords(), sourceReached)) {
+            InitializeSubgoalNode(edge.nodeIndex);
+            nodes_[edge.nodeIndex].sampleCost = edge.cost;
+        }
+    }
+
+    // Perform an A* search over the subgoal graph, until the sample is reached.
+    queue_ = std::priority_queue<QueueNode, std::vector<QueueNode>, LowerPriority>{};
+    if (!sampleReached) {
+        CountStatistic(Tree().Statistics().pushes);
+        queue_.push({ sourceIndex_, PathCost(0), Neighborhood<L>::StandardCost(SampleCoords() - SourceCoords()) });
+    }
+    while (!queue_.empty() && !sampleReached) {
+        const QueueNode node = queue_.top();
+        queue_.pop();
+        if (node.gCost != nodes_[node.nodeIndex].gCost) {
+            CountStatistic(Tree().Statistics().stalePops);
+        }
+        else {
+            // Expand the node, unless it is the sample. A source that is not a subgoal has its own edges,
+            // and a subgoal may have an edge to a sample that is not a subgoal.
+            sampleReached = (node.nodeIndex == sampleIndex_);
+            if (!sampleReached) {
+                CountStatistic(Tree().Statistics().expansions);
+                if (node.nodeIndex == subgoalCount) {
+                    for (const SubgoalEdge& edge : sourceEdges_) {
+                        RelaxEdge(node.nodeIndex, edge);
+                    }
+                }
+                else {
+                    for (int i = edgeOffsets_[node.nodeIndex]; i < edgeOffsets_[node.nodeIndex + 1]; ++i) {
+                        RelaxEdge(node.nodeIndex, edges_[i]);
+                    }
+                    if (nodes_[node.nodeIndex].sampleCost < PathCost::MaxCost()) {
+                        RelaxEdge(node.nodeIndex, { sampleIndex_, nodes_[node.nodeIndex].sampleCost });
+                    }
+                }
+            }
+        }
+    }
+
+    // Trace the parents from the sample back to the source.
+    std::vector<int> nodePath{};
+    if (sampleReached) {
+        for (int nodeIndex = sampleIndex_; nodeIndex != sourceIndex_; nodeIndex = nodes_[nodeIndex].parentIndex) {
+            nodePath.push_back(nodeIndex);
+        }
+        nodePath.push_back(sourceIndex_);
+        std::reverse(std::begin(nodePath), std::end(nodePath));
+    }
+    return nodePath;
+}
+
+template <int L>
+inline void SubgoalGraphSearch<L>::InitializeSubgoalNode(int nodeIndex)
+{
+    SubgoalNode& node = nodes_[nodeIndex];
+    if (node.queryID != currentQueryID_) {
+        node.queryID = currentQueryID_;
+        node.gCost = PathCost::MaxCost();
+        node.sampleCost = PathCost::MaxCost();
+        node.parentIndex = -1;
+    }
+}
+
+template <int L>
+inline void SubgoalGraphSearch<L>::RelaxEdge(int nodeIndex, const SubgoalEdge& edge)
+{
+    InitializeSubgoalNode(edge.nodeIndex);
+    const PathCost gCost = nodes_[nodeIndex].gCost + edge.cost;
+    if (gCost < nodes_[edge.nodeIndex].gCost) {
+        nodes_[edge.nodeIndex].gCost = gCost;
+        nodes_[edge.nodeIndex].parentIndex = nodeIndex;
+        CountStatistic(Tree().Statistics().pushes);
+        queue_.push({ edge.nodeIndex, gCost, gCost + Neighborhood<L>::StandardCost(SampleCoords() - NodeCoords(edge.nodeIndex)) });
+    }
+}
+
+template <int L>
+inline Offset2D SubgoalGraphSearch<L>::NodeCoords(int nodeIndex) const
+{
+    const int subgoalCount = int(subgoals_.size());
+    return (nodeIndex < subgoalCount) ? subgoals_[nodeIndex] :
+           (nodeIndex == subgoalCount) ? SourceCoords() :
+                                         SampleCoords();
+}
+
+}  // namespace
+
+#endif
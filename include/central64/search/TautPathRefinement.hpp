@@ -0,0 +1,111 @@
+#pragma once
+#ifndef CENTRAL64_TAUT_PATH_REFINEMENT
+#define CENTRAL64_TAUT_PATH_REFINEMENT
+
+#include <central64/search/PathTree.hpp>
+
+namespace central64 {
+
+/// A helper for search methods that find a shortest grid path as a sequence of waypoints joined by taut paths,
+/// meaning grid paths whose costs equal the standard costs between their endpoints, in the `L`-neighbor grid.
+/// Each pair of consecutive waypoints is refined by assigning g-costs and parent moves to the vertices of all
+/// taut paths between them, so that regular and central grid paths can be extracted from the path tree and path
+/// flow as usual. Central grid paths are then central among the shortest grid paths through the waypoints.
+template <int L>
+class TautPathRefinement
+{
+public:
+    TautPathRefinement() = default;  ///< Create a taut path refinement object.
+
+    /// Assign the g-cost and parent move of every vertex of `tree` on a taut path from `startCoords` to `endCoords`
+    /// in `grid`, given that the g-cost of the start is `startGCost`. The end must be reachable by a taut path.
+    void RefineTautPath(const Grid2D<L>& grid, PathTree<L>& tree, Offset2D startCoords, Offset2D endCoords, PathCost startGCost);
+
+private:
+    // The coordinates and linear index of a vertex visited while following taut paths.
+    struct FloodVertex {
+        Offset2D coords;
+        int index;
+    };
+
+    TiledArray2D<uint64_t> floodIDs_{};    // The ID of the traversal of taut paths in which each vertex was last visited.
+    uint64_t currentFloodID_{ 0 };
+    std::vector<FloodVertex> floodStack_{};  // The vertices whose taut paths are yet to be followed.
+};
+
+template <int L>
+void TautPathRefinement<L>::RefineTautPath(const Grid2D<L>& grid, PathTree<L>& tree, Offset2D startCoords, Offset2D endCoords, PathCost startGCost)
+{
+    if (floodIDs_.Dims() != grid.Dims()) {
+        floodIDs_ = TiledArray2D<uint64_t>{ grid.Dims(), 0 };
+    }
+
+    // Mark the vertices that a taut path from the start reaches, and from which a taut path may continue
+    // to the end. These are the vertices whose standard costs from the start and to the end sum to the
+    // standard cost between the start and end.
+    const PathCost edgeCost = Neighborhood<L>::StandardCost(endCoords - startCoords);
+    const uint64_t forwardID = ++currentFloodID_;
+    const FloodVertex start{ startCoords, grid.Index(startCoords) };
+    floodIDs_[start.index] = forwardID;
+    floodStack_.assign(1, start);
+    while (!floodStack_.empty()) {
+        const FloodVertex vertex = floodStack_.back();
+        floodStack_.pop_back();
+        CountStatistic(tree.Statistics().jumpCells);
+        const PathCost cost = Neighborhood<L>::StandardCost(vertex.coords - startCoords);
+        for (const Move<L>& move : grid.Neighbors(vertex.index)) {
+            const int neighborIndex = grid.NeighborIndex(vertex.coords, vertex.index, move);
+            if (floodIDs_[neighborIndex] != forwardID) {
+                const Offset2D neighborCoords = vertex.coords + move.Offset();
+                const PathCost neighborCost = Neighborhood<L>::StandardCost(neighborCoords - startCoords);
+                if (neighborCost == cost + move.Cost() && neighborCost + Neighborhood<L>::StandardCost(endCoords - neighborCoords) == edgeCost) {
+                    floodIDs_[neighborIndex] = forwardID;
+                    floodStack_.push_back({ neighborCoords, neighborIndex });
+                }
+            }
+        }
+    }
+
+    // Follow taut paths back from the end through the marked vertices, which excludes any marked vertex
+    // that is cut off from the end. Assign each vertex reached its g-cost, and a parent move toward the start.
+    const FloodVertex end{ endCoords, grid.Index(endCoords) };
+    assert(floodIDs_[end.index] == forwardID);
+    const uint64_t backwardID = ++currentFloodID_;
+    floodIDs_[end.index] = backwardID;
+    floodStack_.assign(1, end);
+    while (!floodStack_.empty()) {
+        const FloodVertex vertex = floodStack_.back();
+        floodStack_.pop_back();
+        CountStatistic(tree.Statistics().jumpCells);
+        const PathCost cost = Neighborhood<L>::StandardCost(endCoords - vertex.coords);
+        const PathCost gCost = startGCost + edgeCost - cost;
+        if (!tree.IsSearchNodeInitialized(vertex.index)) {
+            tree.InitializeHeuristicNode(vertex.coords, vertex.index);
+        }
+        const bool improved = (gCost < tree.GCost(vertex.index));
+        if (improved) {
+            tree.SetGCost(vertex.index, gCost);
+        }
+        bool parentFound = false;
+        for (const Move<L>& move : grid.Neighbors(vertex.index)) {
+            const int neighborIndex = grid.NeighborIndex(vertex.coords, vertex.index, move);
+            if (floodIDs_[neighborIndex] == forwardID || floodIDs_[neighborIndex] == backwardID) {
+                const Offset2D neighborCoords = vertex.coords + move.Offset();
+                if (Neighborhood<L>::StandardCost(endCoords - neighborCoords) == cost + move.Cost()) {
+                    if (improved && !parentFound) {
+                        tree.SetParentMove(vertex.index, move);
+                        parentFound = true;
+                    }
+                    if (floodIDs_[neighborIndex] == forwardID) {
+                        floodIDs_[neighborIndex] = backwardID;
+                        floodStack_.push_back({ neighborCoords, neighborIndex });
+                    }
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+#endif
@@ -0,0 +1,107 @@
+#pragma once
+#ifndef CENTRAL64_WORKER_POOL
+#define CENTRAL64_WORKER_POOL
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace central64 {
+
+/// A pool of worker threads that are created once and then repeatedly run a task alongside the calling thread,
+/// so that the cost of creating threads is not paid for each task.
+class WorkerPool
+{
+public:
+    explicit WorkerPool(int workerCount);  ///< Create a pool of `workerCount` worker threads, which wait for tasks.
+    ~WorkerPool();                         ///< Stop the worker threads and wait for them to finish.
+
+    int WorkerCount() const { return int(workers_.size()); }  ///< Get the number of worker threads, which excludes the calling thread.
+
+    /// Run `task` once on each worker thread and once on the calling thread, and return when every run has finished.
+    /// The task should divide the work among its concurrent runs, for example by claiming items with an atomic counter.
+    void Run(const std::function<void()>& task);
+
+private:
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // Wait for each task to be posted, run it, and report back, until the pool is stopped.
+    void Work();
+
+    std::mutex mutex_{};
+    std::condition_variable taskPosted_{};
+    std::condition_variable taskFinished_{};
+    const std::function<void()>* task_{};  // The task currently posted.
+    int taskNumber_{ 0 };                  // The number of tasks posted, which signals each new task to the workers.
+    int busyWorkers_{ 0 };                 // The number of workers still running the current task.
+    bool stopping_{ false };
+    std::vector<std::thread> workers_{};
+};
+
+inline WorkerPool::WorkerPool(int workerCount)
+{
+    for (int i = 0; i < workerCount; ++i) {
+        workers_.emplace_back([this]() { Work(); });
+    }
+}
+
+inline WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        stopping_ = true;
+    }
+    taskPosted_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+inline void WorkerPool::Run(const std::function<void()>& task)
+{
+    if (!workers_.empty()) {
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            task_ = &task;
+            ++taskNumber_;
+            busyWorkers_ = WorkerCount();
+        }
+        taskPosted_.notify_all();
+    }
+    task();
+    if (!workers_.empty()) {
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        taskFinished_.wait(lock, [&]() { return busyWorkers_ == 0; });
+        task_ = nullptr;
+    }
+}
+
+inline void WorkerPool::Work()
+{
+    int lastTaskNumber = 0;
+    bool working = true;
+    while (working) {
+        const std::function<void()>* task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock{ mutex_ };
+            taskPosted_.wait(lock, [&]() { return stopping_ || taskNumber_ != lastTaskNumber; });
+            working = !stopping_;
+            lastTaskNumber = taskNumber_;
+            task = task_;
+        }
+        if (working) {
+            (*task)();
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            if (--busyWorkers_ == 0) {
+                taskFinished_.notify_one();
+            }
+        }
+    }
+}
+
+}  // namespace
+
+#endif
@@ -3,6 +3,7 @@
 #define CENTRAL64_ABSTRACT_SMOOTHING
 
 #include <central64/grid/Grid2D.hpp>
+#include <central64/search/SearchStatistics.hpp>
 
 namespace central64 {
 
@@ -15,23 +16,40 @@ public:
 
     const Grid2D<L>& Grid() const { return grid_; }  ///< Obtain a const reference to the grid.
 
+    /// Replace a region of input cells in the grid, as described for `Grid2D::UpdateCells`, and return the coordinates
+    /// of every vertex whose set of connections has changed.
+    std::vector<Offset2D> UpdateCells(Offset2D cellCoords, const std::vector<std::vector<bool>>& regionCells) { return grid_.UpdateCells(cellCoords, regionCells); }
+
     virtual void SmoothPath(std::vector<Offset2D>& pathVertices) = 0;  ///< Perform the smoothing operation on a path represented as a vector of 2D offsets (`pathVertices`).
 
     virtual std::string MethodName() const = 0;  ///< Get the name of the smoothing method.
 
+    const SearchStatistics& Statistics() const { return statistics_; }  ///< Get the cumulative smoothing statistics, if statistics counting is enabled.
+    void ResetStatistics() { statistics_ = SearchStatistics{}; }        ///< Reset the cumulative smoothing statistics to zero.
+
 protected:
-    explicit AbstractSmoothing(const Grid2D<L>& grid) : grid_{ grid } {}  ///< Create an abstract smoothing object that references an existing grid object.
+    explicit AbstractSmoothing(const Grid2D<L>& grid) : grid_{ grid }, statistics_{} {}  ///< Create an abstract smoothing object that references an existing grid object.
 
     AbstractSmoothing(AbstractSmoothing&&) = default;             ///< Ensure the default move constructor is protected because the class is to be inherited.
     AbstractSmoothing& operator=(AbstractSmoothing&&) = default;  ///< Ensure the default move assignment operator is protected because the class is to be inherited.
 
+    bool LineOfSight(Offset2D coordsA, Offset2D coordsB);  ///< Check the line of sight between coordinates `coordsA` and `coordsB`, counting the check if statistics counting is enabled.
+
 private:
     AbstractSmoothing(const AbstractSmoothing&) = delete;
     AbstractSmoothing& operator=(const AbstractSmoothing&) = delete;
 
     Grid2D<L> grid_;
+    SearchStatistics statistics_;
 };
 
+template <int L>
+inline bool AbstractSmoothing<L>::LineOfSight(Offset2D coordsA, Offset2D coordsB)
+{
+    CountStatistic(statistics_.lineOfSightChecks);
+    return Grid().LineOfSight(coordsA, coordsB);
+}
+
 }  // namespace
 
 #endif
@@ -21,6 +21,9 @@ public:
     virtual std::string MethodName() const { return "Greedy Smoothing"; }  ///< Get the name of the smoothing method.
 
     const Grid2D<L>& Grid() const { return AbstractSmoothing<L>::Grid(); }
+
+private:
+    bool LineOfSight(Offset2D coordsA, Offset2D coordsB) { return AbstractSmoothing<L>::LineOfSight(coordsA, coordsB); }
 };
 
 template <int L>
@@ -55,7 +58,7 @@ void GreedySmoothing<L>::SmoothPath(std::vector<Offset2D>& pathVertices)
                 // Perform the line-of-sight check only if the offsets have not all been identical.
                 if (offset != uniqueOffset) {
                     uniqueOffset = { 0, 0 };
-                    lineOfSight = Grid().LineOfSight(pathVertices[indexA], pathVertices[indexB]);
+                    lineOfSight = LineOfSight(pathVertices[indexA], pathVertices[indexB]);
                 }
 
                 // If the line of sight is not yet broken, advance B.
@@ -21,6 +21,9 @@ public:
     virtual std::string MethodName() const { return "Tentpole Smoothing"; }  ///< Get the name of the smoothing method.
 
     const Grid2D<L>& Grid() const { return AbstractSmoothing<L>::Grid(); }
+
+private:
+    bool LineOfSight(Offset2D coordsA, Offset2D coordsB) { return AbstractSmoothing<L>::LineOfSight(coordsA, coordsB); }
 };
 
 template <int L>
@@ -64,7 +67,7 @@ void TentpoleSmoothing<L>::SmoothPath(std::vector<Offset2D>& pathVertices)
                     // Perform the line-of-sight check only if the offsets have not all been identical.
                     if (offset != uniqueOffset) {
                         uniqueOffset = { 0, 0 };
-                        lineOfSight = Grid().LineOfSight(pathVertices[indexA], pathVertices[indexC]);
+                        lineOfSight = LineOfSight(pathVertices[indexA], pathVertices[indexC]);
                     }
 
                     // If the line of sight is not yet broken, advance C.
@@ -97,7 +100,7 @@ void TentpoleSmoothing<L>::SmoothPath(std::vector<Offset2D>& pathVertices)
                         // Perform the line-of-sight check only if the offsets have not all been identical.
                         if (offset != uniqueOffset) {
                             uniqueOffset = { 0, 0 };
-                            lineOfSight = Grid().LineOfSight(pathVertices[indexB], pathVertices[indexC]);
+                            lineOfSight = LineOfSight(pathVertices[indexB], pathVertices[indexC]);
                         }
 
                         // If the line of sight is not yet broken, the (1) check whether the new tentpole
@@ -21,6 +21,9 @@ def read_data(mode, benchmark):
             smoothing = line[line.find(" with ") + len(" with "):line.find(" Smoothing")].strip()
             i += 1
             line = lines[i]
+            while not line.startswith("Mean Path Length"):
+                i += 1
+                line = lines[i]
             pathlength = line[len("Mean Path Length = "):].strip()
             i += 1
             line = lines[i]